@@ -9,4 +9,17 @@
 #include "params.h"
 #include "sys.h"
 
+/* Native backends may be compiled as part of every build, but are guarded
+ * by the identifier of the active backend. If the backend is not in use,
+ * the translation unit would be empty, which ISO C forbids. */
+#define MLD_EMPTY_CU(s) extern int MLD_NAMESPACE(empty_cu_##s);
+
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_ARITH)
+#include MLD_CONFIG_ARITH_BACKEND_FILE
+#endif
+
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202)
+#include MLD_CONFIG_FIPS202_BACKEND_FILE
+#endif
+
 #endif /* !MLD_COMMON_H */
@@ -7,6 +7,107 @@
 
 #define MLD_RANDOMIZED_SIGNING
 
+/*
+ * MLD_CONFIG_USE_NATIVE_BACKEND_ARITH
+ *
+ * Determines whether a native arithmetic backend should be used.
+ *
+ * The arithmetic backend covers performance critical functions such as the
+ * number-theoretic transform (NTT). If this option is unset, the C code is
+ * used throughout. If it is set, the backend is determined by
+ * MLD_CONFIG_ARITH_BACKEND_FILE, which defaults to the backend for the
+ * target architecture. Architectures without a backend fall back to C.
+ *
+ * This can also be set using CFLAGS.
+ */
+/* #define MLD_CONFIG_USE_NATIVE_BACKEND_ARITH */
+
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_ARITH) && \
+    !defined(MLD_CONFIG_ARITH_BACKEND_FILE)
+#define MLD_CONFIG_ARITH_BACKEND_FILE "native/meta.h"
+#endif
+
+/*
+ * MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202
+ *
+ * Determines whether a native backend for the Keccak permutation
+ * should be used.
+ *
+ * If this option is unset, the C implementation of Keccak is used
+ * throughout. If it is set, the backend is determined by
+ * MLD_CONFIG_FIPS202_BACKEND_FILE, which defaults to the backend for
+ * the target architecture. Architectures without a backend fall back to C.
+ *
+ * This can also be set using CFLAGS.
+ */
+/* #define MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 */
+
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202) && \
+    !defined(MLD_CONFIG_FIPS202_BACKEND_FILE)
+#define MLD_CONFIG_FIPS202_BACKEND_FILE "fips202/native/meta.h"
+#endif
+
+/*
+ * MLD_CONFIG_KECCAK_INTERLEAVE
+ *
+ * If set to 2 or 4, and no native backend provides the batched Keccak
+ * permutation, the C implementation of the 4-way batched Keccak
+ * (fips202x4.c) permutes 2 or 4 states at once, interleaving their
+ * computation to expose instruction-level parallelism. This is used by
+ * all batched sampling routines.
+ *
+ * Whether this is beneficial depends on the target: It is intended for
+ * superscalar 64-bit cores without SIMD that have enough general purpose
+ * registers to hold multiple states, e.g. 31 on AArch64. On x86_64, with
+ * 16 general purpose registers, it is slower than the default.
+ *
+ * If unset, the states are permuted one after the other.
+ *
+ * This can also be set using CFLAGS.
+ */
+/* #define MLD_CONFIG_KECCAK_INTERLEAVE 2 */
+
+/*
+ * MLD_CONFIG_REDUCE_RAM
+ *
+ * If set, the matrix A is never held in memory. polyvec_matrix_expand()
+ * only records the seed rho, and polyvec_matrix_pointwise_montgomery()
+ * samples every entry of A with poly_uniform() right before it is
+ * multiplied and accumulated. This reduces the stack usage of key
+ * generation, signing and verification, and the size of the expanded
+ * keys, by MLDSA_K * MLDSA_L polynomials, at the cost of regenerating A
+ * in every matrix-vector product, i.e. in every signing attempt.
+ *
+ * This can also be set using CFLAGS.
+ */
+/* #define MLD_CONFIG_REDUCE_RAM */
+
+/*
+ * MLD_CONFIG_USE_PTHREADS
+ *
+ * If set, the multi-threaded verification pool in verify_pool.c and
+ * signing pool in sign_pool.c are built. They depend on POSIX threads
+ * and use malloc(); the rest of the library needs neither.
+ *
+ * This can also be set using CFLAGS. The test Makefile sets it, together
+ * with the compiler and linker flags for POSIX threads, for PTHREADS=1.
+ */
+/* #define MLD_CONFIG_USE_PTHREADS */
+
+/*
+ * MLD_CONFIG_SIGN_STATS
+ *
+ * If set, every signing attempt is counted, together with the check that
+ * rejected it: the norm of z, of r0 = w0 - cs2 or of ct0, or too many
+ * hints. The counters are kept per thread and per parameter set, and are
+ * read and cleared with mld_sign_stats_get() and mld_sign_stats_reset().
+ * They are meant for profiling, and cost a little time in every attempt.
+ *
+ * This can also be set using CFLAGS. The test Makefile sets it for
+ * SIGN_STATS=1.
+ */
+/* #define MLD_CONFIG_SIGN_STATS */
+
 #ifndef MLDSA_MODE
 #define MLDSA_MODE 2
 #endif
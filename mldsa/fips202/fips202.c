@@ -9,7 +9,9 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
+#include "../common.h"
 #include "fips202.h"
 
 #define NROUNDS 24
@@ -29,6 +31,12 @@ __contract__(
   requires(memory_no_alias(x, sizeof(uint8_t) * 8))
 )
 {
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+  /* Compiles to a single (unaligned) load */
+  uint64_t r;
+  memcpy(&r, x, 8);
+  return r;
+#else
   unsigned int i;
   uint64_t r = 0;
 
@@ -41,6 +49,7 @@ __contract__(
   }
 
   return r;
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
 }
 
 /*************************************************
@@ -58,6 +67,10 @@ __contract__(
   assigns(memory_slice(x, sizeof(uint8_t) * 8))
 )
 {
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+  /* Compiles to a single (unaligned) store */
+  memcpy(x, &u, 8);
+#else
   unsigned int i;
 
   for (i = 0; i < 8; i++)
@@ -68,6 +81,7 @@ __contract__(
     /* Explicitly truncate to uint8_t */
     x[i] = (uint8_t)((u >> (8 * i)) & 0xFF);
   }
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
 }
 
 /* Keccak round constants */
@@ -85,17 +99,8 @@ const uint64_t KeccakF_RoundConstants[NROUNDS] = {
     (uint64_t)0x8000000080008081ULL, (uint64_t)0x8000000000008080ULL,
     (uint64_t)0x0000000080000001ULL, (uint64_t)0x8000000080008008ULL};
 
-/*************************************************
- * Name:        KeccakF1600_StatePermute
- *
- * Description: The Keccak F1600 Permutation
- *
- * Arguments:   - uint64_t *state: pointer to input/output Keccak state
- **************************************************/
-static void KeccakF1600_StatePermute(uint64_t state[MLD_KECCAK_LANES])
-__contract__(
-  requires(memory_no_alias(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
-  assigns(memory_slice(state, sizeof(uint64_t) * MLD_KECCAK_LANES)))
+#if !defined(MLD_USE_FIPS202_X1_NATIVE)
+void KeccakF1600_StatePermute(uint64_t state[MLD_KECCAK_LANES])
 {
   unsigned round;
 
@@ -360,6 +365,80 @@ __contract__(
   state[23] = Aso;
   state[24] = Asu;
 }
+#else  /* !MLD_USE_FIPS202_X1_NATIVE */
+void KeccakF1600_StatePermute(uint64_t state[MLD_KECCAK_LANES])
+{
+  keccak_f1600_x1_native(state);
+}
+#endif /* MLD_USE_FIPS202_X1_NATIVE */
+
+void keccak_xor_bytes(uint64_t s[MLD_KECCAK_LANES], unsigned int pos,
+                      const uint8_t *in, unsigned int len)
+{
+  unsigned int end = pos + len;
+
+  while (pos < end && pos % 8 != 0)
+  __loop__(
+    invariant(loop_entry(pos) <= pos && pos <= end)
+    invariant(in == loop_entry(in) + (pos - loop_entry(pos))))
+  {
+    s[pos / 8] ^= (uint64_t)*in++ << 8 * (pos % 8);
+    pos++;
+  }
+
+  while (pos + 8 <= end)
+  __loop__(
+    invariant(loop_entry(pos) <= pos && pos <= end)
+    invariant(in == loop_entry(in) + (pos - loop_entry(pos))))
+  {
+    s[pos / 8] ^= load64(in);
+    in += 8;
+    pos += 8;
+  }
+
+  while (pos < end)
+  __loop__(
+    invariant(loop_entry(pos) <= pos && pos <= end)
+    invariant(in == loop_entry(in) + (pos - loop_entry(pos))))
+  {
+    s[pos / 8] ^= (uint64_t)*in++ << 8 * (pos % 8);
+    pos++;
+  }
+}
+
+void keccak_extract_bytes(uint8_t *out, const uint64_t s[MLD_KECCAK_LANES],
+                          unsigned int pos, unsigned int len)
+{
+  unsigned int end = pos + len;
+
+  while (pos < end && pos % 8 != 0)
+  __loop__(
+    invariant(loop_entry(pos) <= pos && pos <= end)
+    invariant(out == loop_entry(out) + (pos - loop_entry(pos))))
+  {
+    *out++ = (uint8_t)(s[pos / 8] >> 8 * (pos % 8));
+    pos++;
+  }
+
+  while (pos + 8 <= end)
+  __loop__(
+    invariant(loop_entry(pos) <= pos && pos <= end)
+    invariant(out == loop_entry(out) + (pos - loop_entry(pos))))
+  {
+    store64(out, s[pos / 8]);
+    out += 8;
+    pos += 8;
+  }
+
+  while (pos < end)
+  __loop__(
+    invariant(loop_entry(pos) <= pos && pos <= end)
+    invariant(out == loop_entry(out) + (pos - loop_entry(pos))))
+  {
+    *out++ = (uint8_t)(s[pos / 8] >> 8 * (pos % 8));
+    pos++;
+  }
+}
 
 /*************************************************
  * Name:        keccak_init
@@ -400,38 +479,24 @@ __contract__(
   requires(memory_no_alias(in, inlen))
   assigns(memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES)))
 {
-  unsigned int i;
-
   while (pos + inlen >= r)
   __loop__(
-    assigns(pos, i, in, inlen,
+    assigns(pos, in, inlen,
       memory_slice(s, sizeof(uint64_t) *  MLD_KECCAK_LANES))
     invariant(inlen <= loop_entry(inlen))
     invariant(pos < r)
     invariant(in == loop_entry(in) + (loop_entry(inlen) - inlen)))
   {
-    for (i = pos; i < r; i++)
-    __loop__(
-      assigns(i, in, memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES))
-      invariant(i >= pos && i <= r)
-      invariant(in == loop_entry(in) + (i - pos)))
-    {
-      s[i / 8] ^= (uint64_t)*in++ << 8 * (i % 8);
-    }
+    keccak_xor_bytes(s, pos, in, r - pos);
+    in += r - pos;
     inlen -= r - pos;
     KeccakF1600_StatePermute(s);
     pos = 0;
   }
 
-  for (i = pos; i < pos + inlen; i++)
-  __loop__(
-    invariant(i >= pos && i - pos <= inlen)
-    invariant(in == loop_entry(in) + (i - pos)))
-  {
-    s[i / 8] ^= (uint64_t)*in++ << 8 * (i % 8);
-  }
+  keccak_xor_bytes(s, pos, in, (unsigned int)inlen);
 
-  return i;
+  return pos + (unsigned int)inlen;
 }
 
 /*************************************************
@@ -479,12 +544,11 @@ static unsigned int keccak_squeeze(uint8_t *out, size_t outlen, uint64_t s[25],
       KeccakF1600_StatePermute(s);
       pos = 0;
     }
-    for (i = pos; i < r && i < pos + outlen; i++)
-    {
-      *out++ = s[i / 8] >> 8 * (i % 8);
-    }
-    outlen -= i - pos;
-    pos = i;
+    i = (outlen < r - pos) ? (unsigned int)outlen : r - pos;
+    keccak_extract_bytes(out, s, pos, i);
+    out += i;
+    outlen -= i;
+    pos += i;
   }
 
   return pos;
@@ -525,21 +589,14 @@ __contract__(
     invariant(inlen <= loop_entry(inlen))
     invariant(in == loop_entry(in) + (loop_entry(inlen) - inlen)))
   {
-    for (i = 0; i < r / 8; i++)
-    __loop__(invariant(i <= r / 8))
-    {
-      s[i] ^= load64(in + 8 * i);
-    }
+    keccak_xor_bytes(s, 0, in, r);
     in += r;
     inlen -= r;
     KeccakF1600_StatePermute(s);
   }
 
-  for (i = 0; i < inlen; i++)
-  __loop__(invariant(i <= inlen))
-  {
-    s[i / 8] ^= (uint64_t)in[i] << 8 * (i % 8);
-  }
+  i = (unsigned int)inlen;
+  keccak_xor_bytes(s, 0, in, i);
 
   s[i / 8] ^= (uint64_t)p << 8 * (i % 8);
   s[(r - 1) / 8] ^= 1ULL << 63;
@@ -562,15 +619,10 @@ __contract__(
 static void keccak_squeezeblocks(uint8_t *out, size_t nblocks, uint64_t s[25],
                                  unsigned int r)
 {
-  unsigned int i;
-
   while (nblocks)
   {
     KeccakF1600_StatePermute(s);
-    for (i = 0; i < r / 8; i++)
-    {
-      store64(out + 8 * i, s[i]);
-    }
+    keccak_extract_bytes(out, s, 0, r);
     out += r;
     nblocks -= 1;
   }
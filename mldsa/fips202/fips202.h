@@ -28,6 +28,72 @@ typedef struct
 #define KeccakF_RoundConstants FIPS202_NAMESPACE(KeccakF_RoundConstants)
 extern const uint64_t KeccakF_RoundConstants[];
 
+#define KeccakF1600_StatePermute FIPS202_NAMESPACE(KeccakF1600_StatePermute)
+/*************************************************
+ * Name:        KeccakF1600_StatePermute
+ *
+ * Description: The Keccak F1600 Permutation
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output Keccak state
+ **************************************************/
+void KeccakF1600_StatePermute(uint64_t state[MLD_KECCAK_LANES])
+__contract__(
+  requires(memory_no_alias(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
+  assigns(memory_slice(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
+);
+
+#define keccak_xor_bytes FIPS202_NAMESPACE(keccak_xor_bytes)
+/*************************************************
+ * Name:        keccak_xor_bytes
+ *
+ * Description: XOR bytes into the Keccak state, starting at byte
+ *              position pos of the state, in little-endian order.
+ *
+ *              Whole lanes are processed with load64(); bytes are only
+ *              handled individually up to the first and after the last
+ *              lane boundary.
+ *
+ * Arguments:   - uint64_t *s: pointer to Keccak state
+ *              - unsigned int pos: byte position in the state
+ *              - const uint8_t *in: pointer to input bytes
+ *              - unsigned int len: number of bytes
+ **************************************************/
+void keccak_xor_bytes(uint64_t s[MLD_KECCAK_LANES], unsigned int pos,
+                      const uint8_t *in, unsigned int len)
+__contract__(
+  requires(pos <= sizeof(uint64_t) * MLD_KECCAK_LANES)
+  requires(len <= sizeof(uint64_t) * MLD_KECCAK_LANES - pos)
+  requires(memory_no_alias(s, sizeof(uint64_t) * MLD_KECCAK_LANES))
+  requires(memory_no_alias(in, len))
+  assigns(memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES))
+);
+
+#define keccak_extract_bytes FIPS202_NAMESPACE(keccak_extract_bytes)
+/*************************************************
+ * Name:        keccak_extract_bytes
+ *
+ * Description: Extract bytes from the Keccak state, starting at byte
+ *              position pos of the state, in little-endian order.
+ *
+ *              Whole lanes are processed with store64(); bytes are only
+ *              handled individually up to the first and after the last
+ *              lane boundary.
+ *
+ * Arguments:   - uint8_t *out: pointer to output bytes
+ *              - const uint64_t *s: pointer to Keccak state
+ *              - unsigned int pos: byte position in the state
+ *              - unsigned int len: number of bytes
+ **************************************************/
+void keccak_extract_bytes(uint8_t *out, const uint64_t s[MLD_KECCAK_LANES],
+                          unsigned int pos, unsigned int len)
+__contract__(
+  requires(pos <= sizeof(uint64_t) * MLD_KECCAK_LANES)
+  requires(len <= sizeof(uint64_t) * MLD_KECCAK_LANES - pos)
+  requires(memory_no_alias(s, sizeof(uint64_t) * MLD_KECCAK_LANES))
+  requires(memory_no_alias(out, len))
+  assigns(memory_slice(out, len))
+);
+
 #define shake128_init FIPS202_NAMESPACE(shake128_init)
 void shake128_init(keccak_state *state);
 #define shake128_absorb FIPS202_NAMESPACE(shake128_absorb)
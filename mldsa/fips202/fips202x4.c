@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../common.h"
+#include "fips202.h"
+#include "fips202x4.h"
+
+#if !defined(MLD_USE_FIPS202_X4_NATIVE) && \
+    defined(MLD_CONFIG_KECCAK_INTERLEAVE)
+#if MLD_CONFIG_KECCAK_INTERLEAVE == 2
+#define MLD_KECCAK_FOR_WAY(M) M(0) M(1)
+#elif MLD_CONFIG_KECCAK_INTERLEAVE == 4
+#define MLD_KECCAK_FOR_WAY(M) M(0) M(1) M(2) M(3)
+#else
+#error "MLD_CONFIG_KECCAK_INTERLEAVE must be 2 or 4"
+#endif
+
+#define ROL(a, offset) (((a) << (offset)) ^ ((a) >> (64 - (offset))))
+
+/*
+ * The steps of one round of Keccak-f[1600] for the state with index k,
+ * using lane variables suffixed with _k. Lane i is at position
+ * (i % 5, i / 5) of the state.
+ */
+#define MLD_KECCAK_DECLARE(k)                      \
+  uint64_t A0_##k, A1_##k, A2_##k, A3_##k, A4_##k, \
+      A5_##k, A6_##k, A7_##k, A8_##k, A9_##k,      \
+      A10_##k, A11_##k, A12_##k, A13_##k, A14_##k, \
+      A15_##k, A16_##k, A17_##k, A18_##k, A19_##k, \
+      A20_##k, A21_##k, A22_##k, A23_##k, A24_##k; \
+  uint64_t B0_##k, B1_##k, B2_##k, B3_##k, B4_##k, \
+      B5_##k, B6_##k, B7_##k, B8_##k, B9_##k,      \
+      B10_##k, B11_##k, B12_##k, B13_##k, B14_##k, \
+      B15_##k, B16_##k, B17_##k, B18_##k, B19_##k, \
+      B20_##k, B21_##k, B22_##k, B23_##k, B24_##k; \
+  uint64_t C0_##k, C1_##k, C2_##k, C3_##k, C4_##k; \
+  uint64_t D0_##k, D1_##k, D2_##k, D3_##k, D4_##k;
+
+#define MLD_KECCAK_LOAD(k)                \
+  A0_##k = s[MLD_KECCAK_LANES * k + 0];   \
+  A1_##k = s[MLD_KECCAK_LANES * k + 1];   \
+  A2_##k = s[MLD_KECCAK_LANES * k + 2];   \
+  A3_##k = s[MLD_KECCAK_LANES * k + 3];   \
+  A4_##k = s[MLD_KECCAK_LANES * k + 4];   \
+  A5_##k = s[MLD_KECCAK_LANES * k + 5];   \
+  A6_##k = s[MLD_KECCAK_LANES * k + 6];   \
+  A7_##k = s[MLD_KECCAK_LANES * k + 7];   \
+  A8_##k = s[MLD_KECCAK_LANES * k + 8];   \
+  A9_##k = s[MLD_KECCAK_LANES * k + 9];   \
+  A10_##k = s[MLD_KECCAK_LANES * k + 10]; \
+  A11_##k = s[MLD_KECCAK_LANES * k + 11]; \
+  A12_##k = s[MLD_KECCAK_LANES * k + 12]; \
+  A13_##k = s[MLD_KECCAK_LANES * k + 13]; \
+  A14_##k = s[MLD_KECCAK_LANES * k + 14]; \
+  A15_##k = s[MLD_KECCAK_LANES * k + 15]; \
+  A16_##k = s[MLD_KECCAK_LANES * k + 16]; \
+  A17_##k = s[MLD_KECCAK_LANES * k + 17]; \
+  A18_##k = s[MLD_KECCAK_LANES * k + 18]; \
+  A19_##k = s[MLD_KECCAK_LANES * k + 19]; \
+  A20_##k = s[MLD_KECCAK_LANES * k + 20]; \
+  A21_##k = s[MLD_KECCAK_LANES * k + 21]; \
+  A22_##k = s[MLD_KECCAK_LANES * k + 22]; \
+  A23_##k = s[MLD_KECCAK_LANES * k + 23]; \
+  A24_##k = s[MLD_KECCAK_LANES * k + 24];
+
+#define MLD_KECCAK_STORE(k)               \
+  s[MLD_KECCAK_LANES * k + 0] = A0_##k;   \
+  s[MLD_KECCAK_LANES * k + 1] = A1_##k;   \
+  s[MLD_KECCAK_LANES * k + 2] = A2_##k;   \
+  s[MLD_KECCAK_LANES * k + 3] = A3_##k;   \
+  s[MLD_KECCAK_LANES * k + 4] = A4_##k;   \
+  s[MLD_KECCAK_LANES * k + 5] = A5_##k;   \
+  s[MLD_KECCAK_LANES * k + 6] = A6_##k;   \
+  s[MLD_KECCAK_LANES * k + 7] = A7_##k;   \
+  s[MLD_KECCAK_LANES * k + 8] = A8_##k;   \
+  s[MLD_KECCAK_LANES * k + 9] = A9_##k;   \
+  s[MLD_KECCAK_LANES * k + 10] = A10_##k; \
+  s[MLD_KECCAK_LANES * k + 11] = A11_##k; \
+  s[MLD_KECCAK_LANES * k + 12] = A12_##k; \
+  s[MLD_KECCAK_LANES * k + 13] = A13_##k; \
+  s[MLD_KECCAK_LANES * k + 14] = A14_##k; \
+  s[MLD_KECCAK_LANES * k + 15] = A15_##k; \
+  s[MLD_KECCAK_LANES * k + 16] = A16_##k; \
+  s[MLD_KECCAK_LANES * k + 17] = A17_##k; \
+  s[MLD_KECCAK_LANES * k + 18] = A18_##k; \
+  s[MLD_KECCAK_LANES * k + 19] = A19_##k; \
+  s[MLD_KECCAK_LANES * k + 20] = A20_##k; \
+  s[MLD_KECCAK_LANES * k + 21] = A21_##k; \
+  s[MLD_KECCAK_LANES * k + 22] = A22_##k; \
+  s[MLD_KECCAK_LANES * k + 23] = A23_##k; \
+  s[MLD_KECCAK_LANES * k + 24] = A24_##k;
+
+#define MLD_KECCAK_THETA(k)                               \
+  C0_##k = A0_##k ^ A5_##k ^ A10_##k ^ A15_##k ^ A20_##k; \
+  C1_##k = A1_##k ^ A6_##k ^ A11_##k ^ A16_##k ^ A21_##k; \
+  C2_##k = A2_##k ^ A7_##k ^ A12_##k ^ A17_##k ^ A22_##k; \
+  C3_##k = A3_##k ^ A8_##k ^ A13_##k ^ A18_##k ^ A23_##k; \
+  C4_##k = A4_##k ^ A9_##k ^ A14_##k ^ A19_##k ^ A24_##k; \
+  D0_##k = C4_##k ^ ROL(C1_##k, 1);                       \
+  D1_##k = C0_##k ^ ROL(C2_##k, 1);                       \
+  D2_##k = C1_##k ^ ROL(C3_##k, 1);                       \
+  D3_##k = C2_##k ^ ROL(C4_##k, 1);                       \
+  D4_##k = C3_##k ^ ROL(C0_##k, 1);
+
+#define MLD_KECCAK_RHO_PI(k)           \
+  B0_##k = A0_##k ^ D0_##k;            \
+  B10_##k = ROL(A1_##k ^ D1_##k, 1);   \
+  B20_##k = ROL(A2_##k ^ D2_##k, 62);  \
+  B5_##k = ROL(A3_##k ^ D3_##k, 28);   \
+  B15_##k = ROL(A4_##k ^ D4_##k, 27);  \
+  B16_##k = ROL(A5_##k ^ D0_##k, 36);  \
+  B1_##k = ROL(A6_##k ^ D1_##k, 44);   \
+  B11_##k = ROL(A7_##k ^ D2_##k, 6);   \
+  B21_##k = ROL(A8_##k ^ D3_##k, 55);  \
+  B6_##k = ROL(A9_##k ^ D4_##k, 20);   \
+  B7_##k = ROL(A10_##k ^ D0_##k, 3);   \
+  B17_##k = ROL(A11_##k ^ D1_##k, 10); \
+  B2_##k = ROL(A12_##k ^ D2_##k, 43);  \
+  B12_##k = ROL(A13_##k ^ D3_##k, 25); \
+  B22_##k = ROL(A14_##k ^ D4_##k, 39); \
+  B23_##k = ROL(A15_##k ^ D0_##k, 41); \
+  B8_##k = ROL(A16_##k ^ D1_##k, 45);  \
+  B18_##k = ROL(A17_##k ^ D2_##k, 15); \
+  B3_##k = ROL(A18_##k ^ D3_##k, 21);  \
+  B13_##k = ROL(A19_##k ^ D4_##k, 8);  \
+  B14_##k = ROL(A20_##k ^ D0_##k, 18); \
+  B24_##k = ROL(A21_##k ^ D1_##k, 2);  \
+  B9_##k = ROL(A22_##k ^ D2_##k, 61);  \
+  B19_##k = ROL(A23_##k ^ D3_##k, 56); \
+  B4_##k = ROL(A24_##k ^ D4_##k, 14);
+
+#define MLD_KECCAK_CHI_IOTA(k)              \
+  A0_##k = B0_##k ^ (~B1_##k & B2_##k);     \
+  A1_##k = B1_##k ^ (~B2_##k & B3_##k);     \
+  A2_##k = B2_##k ^ (~B3_##k & B4_##k);     \
+  A3_##k = B3_##k ^ (~B4_##k & B0_##k);     \
+  A4_##k = B4_##k ^ (~B0_##k & B1_##k);     \
+  A5_##k = B5_##k ^ (~B6_##k & B7_##k);     \
+  A6_##k = B6_##k ^ (~B7_##k & B8_##k);     \
+  A7_##k = B7_##k ^ (~B8_##k & B9_##k);     \
+  A8_##k = B8_##k ^ (~B9_##k & B5_##k);     \
+  A9_##k = B9_##k ^ (~B5_##k & B6_##k);     \
+  A10_##k = B10_##k ^ (~B11_##k & B12_##k); \
+  A11_##k = B11_##k ^ (~B12_##k & B13_##k); \
+  A12_##k = B12_##k ^ (~B13_##k & B14_##k); \
+  A13_##k = B13_##k ^ (~B14_##k & B10_##k); \
+  A14_##k = B14_##k ^ (~B10_##k & B11_##k); \
+  A15_##k = B15_##k ^ (~B16_##k & B17_##k); \
+  A16_##k = B16_##k ^ (~B17_##k & B18_##k); \
+  A17_##k = B17_##k ^ (~B18_##k & B19_##k); \
+  A18_##k = B18_##k ^ (~B19_##k & B15_##k); \
+  A19_##k = B19_##k ^ (~B15_##k & B16_##k); \
+  A20_##k = B20_##k ^ (~B21_##k & B22_##k); \
+  A21_##k = B21_##k ^ (~B22_##k & B23_##k); \
+  A22_##k = B22_##k ^ (~B23_##k & B24_##k); \
+  A23_##k = B23_##k ^ (~B24_##k & B20_##k); \
+  A24_##k = B24_##k ^ (~B20_##k & B21_##k); \
+  A0_##k ^= KeccakF_RoundConstants[round];
+
+/*************************************************
+ * Name:        mld_keccakf1600_permute_interleaved
+ *
+ * Description: Applies the Keccak F1600 permutation to
+ *              MLD_CONFIG_KECCAK_INTERLEAVE independent states at once.
+ *
+ *              Every step of a round is written out for all states
+ *              before the next step, with each state held in its own
+ *              set of scalar variables. The independent dependency
+ *              chains can then be scheduled side by side, which keeps
+ *              the issue slots of superscalar cores without SIMD busy.
+ *
+ * Arguments:   - uint64_t *s: pointer to MLD_CONFIG_KECCAK_INTERLEAVE
+ *                consecutive Keccak states
+ **************************************************/
+static void mld_keccakf1600_permute_interleaved(uint64_t *s)
+{
+  MLD_KECCAK_FOR_WAY(MLD_KECCAK_DECLARE)
+  unsigned int round;
+
+  MLD_KECCAK_FOR_WAY(MLD_KECCAK_LOAD)
+
+  for (round = 0; round < 24; round++)
+  {
+    MLD_KECCAK_FOR_WAY(MLD_KECCAK_THETA)
+    MLD_KECCAK_FOR_WAY(MLD_KECCAK_RHO_PI)
+    MLD_KECCAK_FOR_WAY(MLD_KECCAK_CHI_IOTA)
+  }
+
+  MLD_KECCAK_FOR_WAY(MLD_KECCAK_STORE)
+}
+#endif /* !MLD_USE_FIPS202_X4_NATIVE && MLD_CONFIG_KECCAK_INTERLEAVE */
+
+/*************************************************
+ * Name:        mld_keccakf1600x4_permute
+ *
+ * Description: Applies the Keccak F1600 permutation to 4 independent
+ *              states, using the native backend if available. Otherwise,
+ *              the states are permuted in groups of
+ *              MLD_CONFIG_KECCAK_INTERLEAVE if set, or one by one.
+ *
+ * Arguments:   - uint64_t *s: pointer to 4 consecutive Keccak states
+ **************************************************/
+static void mld_keccakf1600x4_permute(uint64_t *s)
+{
+#if defined(MLD_USE_FIPS202_X4_NATIVE)
+  keccak_f1600_x4_native(s);
+#elif defined(MLD_CONFIG_KECCAK_INTERLEAVE)
+  unsigned int j;
+  for (j = 0; j < MLD_KECCAK_WAY; j += MLD_CONFIG_KECCAK_INTERLEAVE)
+  {
+    mld_keccakf1600_permute_interleaved(s + MLD_KECCAK_LANES * j);
+  }
+#else
+  unsigned int j;
+  for (j = 0; j < MLD_KECCAK_WAY; j++)
+  {
+    KeccakF1600_StatePermute(s + MLD_KECCAK_LANES * j);
+  }
+#endif
+}
+
+/*************************************************
+ * Name:        mld_keccakx4_absorb_once
+ *
+ * Description: Absorb step of 4 independent Keccak instances;
+ *              non-incremental, starts by zeroeing the states.
+ *
+ * Arguments:   - uint64_t *s: pointer to (uninitialized) output Keccak
+ *                states
+ *              - unsigned int r: rate in bytes (e.g., 168 for SHAKE128)
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs
+ *              - size_t inlen: length of each input in bytes
+ *              - uint8_t p: domain-separation byte
+ **************************************************/
+static void mld_keccakx4_absorb_once(uint64_t *s, unsigned int r,
+                                     const uint8_t *in0, const uint8_t *in1,
+                                     const uint8_t *in2, const uint8_t *in3,
+                                     size_t inlen, uint8_t p)
+{
+  unsigned int i, j;
+  const uint8_t *in[MLD_KECCAK_WAY];
+
+  in[0] = in0;
+  in[1] = in1;
+  in[2] = in2;
+  in[3] = in3;
+
+  for (i = 0; i < MLD_KECCAK_LANES * MLD_KECCAK_WAY; i++)
+  {
+    s[i] = 0;
+  }
+
+  while (inlen >= r)
+  {
+    for (j = 0; j < MLD_KECCAK_WAY; j++)
+    {
+      keccak_xor_bytes(s + MLD_KECCAK_LANES * j, 0, in[j], r);
+      in[j] += r;
+    }
+    inlen -= r;
+    mld_keccakf1600x4_permute(s);
+  }
+
+  for (j = 0; j < MLD_KECCAK_WAY; j++)
+  {
+    uint64_t *sj = s + MLD_KECCAK_LANES * j;
+    keccak_xor_bytes(sj, 0, in[j], (unsigned int)inlen);
+    sj[inlen / 8] ^= (uint64_t)p << 8 * (inlen % 8);
+    sj[(r - 1) / 8] ^= 1ULL << 63;
+  }
+}
+
+/*************************************************
+ * Name:        mld_keccakx4_squeezeblocks
+ *
+ * Description: Squeeze step of 4 independent Keccak instances. Squeezes
+ *              full blocks of r bytes each from each state.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+ *              - size_t nblocks: number of blocks to be squeezed
+ *              - uint64_t *s: pointer to input/output Keccak states
+ *              - unsigned int r: rate in bytes (e.g., 168 for SHAKE128)
+ **************************************************/
+static void mld_keccakx4_squeezeblocks(uint8_t *out0, uint8_t *out1,
+                                       uint8_t *out2, uint8_t *out3,
+                                       size_t nblocks, uint64_t *s,
+                                       unsigned int r)
+{
+  while (nblocks)
+  {
+    mld_keccakf1600x4_permute(s);
+    keccak_extract_bytes(out0, s + MLD_KECCAK_LANES * 0, 0, r);
+    keccak_extract_bytes(out1, s + MLD_KECCAK_LANES * 1, 0, r);
+    keccak_extract_bytes(out2, s + MLD_KECCAK_LANES * 2, 0, r);
+    keccak_extract_bytes(out3, s + MLD_KECCAK_LANES * 3, 0, r);
+    out0 += r;
+    out1 += r;
+    out2 += r;
+    out3 += r;
+    nblocks--;
+  }
+}
+
+void shake128x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen)
+{
+  mld_keccakx4_absorb_once(state->ctx, SHAKE128_RATE, in0, in1, in2, in3,
+                           inlen, 0x1F);
+}
+
+void shake128x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state)
+{
+  mld_keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, state->ctx,
+                             SHAKE128_RATE);
+}
+
+void shake256x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen)
+{
+  mld_keccakx4_absorb_once(state->ctx, SHAKE256_RATE, in0, in1, in2, in3,
+                           inlen, 0x1F);
+}
+
+void shake256x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state)
+{
+  mld_keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, state->ctx,
+                             SHAKE256_RATE);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_FIPS202X4_H
+#define MLD_FIPS202_FIPS202X4_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../cbmc.h"
+#include "fips202.h"
+
+#define MLD_KECCAK_WAY 4
+
+/* 4 independent Keccak states, stored one after the other */
+typedef struct
+{
+  uint64_t ctx[MLD_KECCAK_LANES * MLD_KECCAK_WAY];
+} keccakx4_state;
+
+#define shake128x4_absorb_once FIPS202_NAMESPACE(shake128x4_absorb_once)
+/*************************************************
+ * Name:        shake128x4_absorb_once
+ *
+ * Description: Initialize, absorb into and finalize 4 independent
+ *              SHAKE128 XOFs; non-incremental.
+ *
+ * Arguments:   - keccakx4_state *state: pointer to (uninitialized) output
+ *                Keccak states
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs to be
+ *                absorbed into the respective state
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void shake128x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen)
+__contract__(
+  requires(memory_no_alias(state, sizeof(keccakx4_state)))
+  requires(memory_no_alias(in0, inlen))
+  requires(memory_no_alias(in1, inlen))
+  requires(memory_no_alias(in2, inlen))
+  requires(memory_no_alias(in3, inlen))
+  assigns(memory_slice(state, sizeof(keccakx4_state)))
+);
+
+#define shake128x4_squeezeblocks FIPS202_NAMESPACE(shake128x4_squeezeblocks)
+/*************************************************
+ * Name:        shake128x4_squeezeblocks
+ *
+ * Description: Squeeze step of 4 independent SHAKE128 XOFs. Squeezes
+ *              full blocks of SHAKE128_RATE bytes each from each state.
+ *              Can be called multiple times to keep squeezing.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+ *              - size_t nblocks: number of blocks to be squeezed (written
+ *                to each output)
+ *              - keccakx4_state *state: pointer to input/output Keccak
+ *                states
+ **************************************************/
+void shake128x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state)
+__contract__(
+  requires(nblocks <= 8 /* somewhat arbitrary bound */)
+  requires(memory_no_alias(state, sizeof(keccakx4_state)))
+  requires(memory_no_alias(out0, nblocks * SHAKE128_RATE))
+  requires(memory_no_alias(out1, nblocks * SHAKE128_RATE))
+  requires(memory_no_alias(out2, nblocks * SHAKE128_RATE))
+  requires(memory_no_alias(out3, nblocks * SHAKE128_RATE))
+  assigns(memory_slice(out0, nblocks * SHAKE128_RATE),
+    memory_slice(out1, nblocks * SHAKE128_RATE),
+    memory_slice(out2, nblocks * SHAKE128_RATE),
+    memory_slice(out3, nblocks * SHAKE128_RATE),
+    memory_slice(state, sizeof(keccakx4_state)))
+);
+
+#define shake256x4_absorb_once FIPS202_NAMESPACE(shake256x4_absorb_once)
+/*************************************************
+ * Name:        shake256x4_absorb_once
+ *
+ * Description: Initialize, absorb into and finalize 4 independent
+ *              SHAKE256 XOFs; non-incremental.
+ *
+ * Arguments:   - keccakx4_state *state: pointer to (uninitialized) output
+ *                Keccak states
+ *              - const uint8_t *in0, ..., *in3: pointers to inputs to be
+ *                absorbed into the respective state
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+void shake256x4_absorb_once(keccakx4_state *state, const uint8_t *in0,
+                            const uint8_t *in1, const uint8_t *in2,
+                            const uint8_t *in3, size_t inlen)
+__contract__(
+  requires(memory_no_alias(state, sizeof(keccakx4_state)))
+  requires(memory_no_alias(in0, inlen))
+  requires(memory_no_alias(in1, inlen))
+  requires(memory_no_alias(in2, inlen))
+  requires(memory_no_alias(in3, inlen))
+  assigns(memory_slice(state, sizeof(keccakx4_state)))
+);
+
+#define shake256x4_squeezeblocks FIPS202_NAMESPACE(shake256x4_squeezeblocks)
+/*************************************************
+ * Name:        shake256x4_squeezeblocks
+ *
+ * Description: Squeeze step of 4 independent SHAKE256 XOFs. Squeezes
+ *              full blocks of SHAKE256_RATE bytes each from each state.
+ *              Can be called multiple times to keep squeezing.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+ *              - size_t nblocks: number of blocks to be squeezed (written
+ *                to each output)
+ *              - keccakx4_state *state: pointer to input/output Keccak
+ *                states
+ **************************************************/
+void shake256x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                              uint8_t *out3, size_t nblocks,
+                              keccakx4_state *state)
+__contract__(
+  requires(nblocks <= 8 /* somewhat arbitrary bound */)
+  requires(memory_no_alias(state, sizeof(keccakx4_state)))
+  requires(memory_no_alias(out0, nblocks * SHAKE256_RATE))
+  requires(memory_no_alias(out1, nblocks * SHAKE256_RATE))
+  requires(memory_no_alias(out2, nblocks * SHAKE256_RATE))
+  requires(memory_no_alias(out3, nblocks * SHAKE256_RATE))
+  assigns(memory_slice(out0, nblocks * SHAKE256_RATE),
+    memory_slice(out1, nblocks * SHAKE256_RATE),
+    memory_slice(out2, nblocks * SHAKE256_RATE),
+    memory_slice(out3, nblocks * SHAKE256_RATE),
+    memory_slice(state, sizeof(keccakx4_state)))
+);
+
+#endif /* !MLD_FIPS202_FIPS202X4_H */
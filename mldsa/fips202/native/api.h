@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_NATIVE_API_H
+#define MLD_FIPS202_NATIVE_API_H
+
+/*
+ * FIPS202 native interface
+ *
+ * This header documents the Keccak primitives a native backend may
+ * provide. As for the arithmetic backend, the backend announces which
+ * primitives it replaces by defining MLD_USE_FIPS202_XXX_NATIVE, and
+ * provides a static inline function with the signature documented below.
+ */
+
+#include <stdint.h>
+#include "../../sys.h"
+#include "../fips202.h"
+
+#if defined(MLD_USE_FIPS202_X1_NATIVE)
+/*************************************************
+ * Name:        keccak_f1600_x1_native
+ *
+ * Description: Applies the Keccak-f[1600] permutation to a single
+ *              state in place.
+ *
+ *              The state layout is the same as for the C function
+ *              KeccakF1600_StatePermute(), and is restored on return:
+ *              any internal representation, such as complemented
+ *              lanes, is local to the backend.
+ *
+ * Arguments:   - uint64_t *state: pointer to Keccak state of
+ *                MLD_KECCAK_LANES lanes
+ **************************************************/
+static MLD_INLINE void keccak_f1600_x1_native(uint64_t *state);
+#endif /* MLD_USE_FIPS202_X1_NATIVE */
+
+#if defined(MLD_USE_FIPS202_X4_NATIVE)
+/*************************************************
+ * Name:        keccak_f1600_x4_native
+ *
+ * Description: Applies the Keccak-f[1600] permutation to 4 independent
+ *              states in place.
+ *
+ * Arguments:   - uint64_t *state: pointer to 4 consecutive Keccak states
+ *                of MLD_KECCAK_LANES lanes each, in the same layout as
+ *                for KeccakF1600_StatePermute().
+ **************************************************/
+static MLD_INLINE void keccak_f1600_x4_native(uint64_t *state);
+#endif /* MLD_USE_FIPS202_X4_NATIVE */
+
+#endif /* !MLD_FIPS202_NATIVE_API_H */
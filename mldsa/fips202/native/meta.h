@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_NATIVE_META_H
+#define MLD_FIPS202_NATIVE_META_H
+
+/*
+ * Default FIPS202 backend
+ *
+ * Selects the native Keccak backend for the target architecture, if any.
+ * If no backend is available, nothing is defined here and the C
+ * implementation is used throughout.
+ */
+
+#if defined(MLD_SYS_X86_64_AVX2) || defined(MLD_SYS_X86_64_BMI2)
+#include "x86_64/meta.h"
+#endif
+
+#endif /* !MLD_FIPS202_NATIVE_META_H */
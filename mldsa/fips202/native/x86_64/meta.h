@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_NATIVE_X86_64_META_H
+#define MLD_FIPS202_NATIVE_X86_64_META_H
+
+/* Identifiers for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#if defined(MLD_SYS_X86_64_AVX2)
+#define MLD_FIPS202_BACKEND_X86_64_AVX2
+#endif
+#if defined(MLD_SYS_X86_64_BMI2)
+#define MLD_FIPS202_BACKEND_X86_64_BMI2
+#endif
+
+#define MLD_FIPS202_BACKEND_NAME X86_64
+
+/* Set of primitives that this backend replaces */
+#if defined(MLD_FIPS202_BACKEND_X86_64_BMI2)
+#define MLD_USE_FIPS202_X1_NATIVE
+#endif
+#if defined(MLD_FIPS202_BACKEND_X86_64_AVX2)
+#define MLD_USE_FIPS202_X4_NATIVE
+#endif
+
+#if !defined(__ASSEMBLER__)
+#include "../api.h"
+#include "src/fips202_native_x86_64.h"
+
+#if defined(MLD_USE_FIPS202_X1_NATIVE)
+static MLD_INLINE void keccak_f1600_x1_native(uint64_t *state)
+{
+  keccakf1600_permute24_bmi2(state);
+}
+#endif /* MLD_USE_FIPS202_X1_NATIVE */
+
+#if defined(MLD_USE_FIPS202_X4_NATIVE)
+static MLD_INLINE void keccak_f1600_x4_native(uint64_t *state)
+{
+  keccakf1600x4_permute24_avx2(state);
+}
+#endif /* MLD_USE_FIPS202_X4_NATIVE */
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_FIPS202_NATIVE_X86_64_META_H */
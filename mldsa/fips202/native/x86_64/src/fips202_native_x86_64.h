@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H
+#define MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H
+
+#include <stdint.h>
+#include "../../../fips202.h"
+
+#define keccakf1600_permute24_bmi2 \
+  FIPS202_NAMESPACE(keccakf1600_permute24_bmi2)
+/*************************************************
+ * Name:        keccakf1600_permute24_bmi2
+ *
+ * Description: Scalar x86_64 implementation of the Keccak-f[1600]
+ *              permutation using BMI1 andn and BMI2 rorx.
+ *
+ *              Uses the lane complementing transform: six lanes are
+ *              kept complemented for the duration of the permutation,
+ *              which removes most NOTs from the chi step. They are
+ *              complemented on entry and back on exit, so the state
+ *              layout is the same as for KeccakF1600_StatePermute().
+ *
+ * Arguments:   - uint64_t *state: pointer to Keccak state of
+ *                MLD_KECCAK_LANES lanes
+ **************************************************/
+void keccakf1600_permute24_bmi2(uint64_t *state);
+
+#define keccakf1600x4_permute24_avx2 \
+  FIPS202_NAMESPACE(keccakf1600x4_permute24_avx2)
+/*************************************************
+ * Name:        keccakf1600x4_permute24_avx2
+ *
+ * Description: AVX2 implementation of 4 parallel Keccak-f[1600]
+ *              permutations.
+ *
+ *              Every 64-bit lane of a 256-bit vector holds the
+ *              corresponding lane of one of the 4 states. The states
+ *              are transposed into this layout on entry and back on
+ *              exit.
+ *
+ * Arguments:   - uint64_t *state: pointer to 4 consecutive Keccak
+ *                states of MLD_KECCAK_LANES lanes each
+ **************************************************/
+void keccakf1600x4_permute24_avx2(uint64_t *state);
+
+#endif /* !MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../../common.h"
+
+#if defined(MLD_FIPS202_BACKEND_X86_64_AVX2)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "fips202_native_x86_64.h"
+
+#define ROL(a, offset)                            \
+  _mm256_or_si256(_mm256_slli_epi64(a, offset), \
+                  _mm256_srli_epi64(a, 64 - (offset)))
+#define XOR5(a, b, c, d, e)                                               \
+  _mm256_xor_si256(                                                       \
+      _mm256_xor_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(c, d)), e)
+#define CHI(a, b, c) _mm256_xor_si256(a, _mm256_andnot_si256(b, c))
+
+/*************************************************
+ * Name:        mld_transpose4x4
+ *
+ * Description: Transposes a 4x4 matrix of 64-bit values held in four
+ *              vectors, converting between 4 lanes of one state and
+ *              one lane of 4 states.
+ **************************************************/
+static MLD_INLINE void mld_transpose4x4(__m256i *r0, __m256i *r1, __m256i *r2,
+                                        __m256i *r3)
+{
+  __m256i t0, t1, t2, t3;
+
+  t0 = _mm256_unpacklo_epi64(*r0, *r1);
+  t1 = _mm256_unpackhi_epi64(*r0, *r1);
+  t2 = _mm256_unpacklo_epi64(*r2, *r3);
+  t3 = _mm256_unpackhi_epi64(*r2, *r3);
+  *r0 = _mm256_permute2x128_si256(t0, t2, 0x20);
+  *r1 = _mm256_permute2x128_si256(t1, t3, 0x20);
+  *r2 = _mm256_permute2x128_si256(t0, t2, 0x31);
+  *r3 = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+void keccakf1600x4_permute24_avx2(uint64_t *state)
+{
+  __m256i A[MLD_KECCAK_LANES], B[MLD_KECCAK_LANES];
+  __m256i C0, C1, C2, C3, C4, D0, D1, D2, D3, D4;
+  unsigned i, round;
+
+  /* Load the states so that A[i] holds lane i of all 4 states */
+  for (i = 0; i < 24; i += 4)
+  {
+    A[i + 0] = _mm256_loadu_si256((const __m256i *)&state[0 * 25 + i]);
+    A[i + 1] = _mm256_loadu_si256((const __m256i *)&state[1 * 25 + i]);
+    A[i + 2] = _mm256_loadu_si256((const __m256i *)&state[2 * 25 + i]);
+    A[i + 3] = _mm256_loadu_si256((const __m256i *)&state[3 * 25 + i]);
+    mld_transpose4x4(&A[i + 0], &A[i + 1], &A[i + 2], &A[i + 3]);
+  }
+  A[24] = _mm256_set_epi64x((int64_t)state[3 * 25 + 24],
+                            (int64_t)state[2 * 25 + 24],
+                            (int64_t)state[1 * 25 + 24],
+                            (int64_t)state[0 * 25 + 24]);
+
+  for (round = 0; round < 24; round++)
+  {
+    /* Theta */
+    C0 = XOR5(A[0], A[5], A[10], A[15], A[20]);
+    C1 = XOR5(A[1], A[6], A[11], A[16], A[21]);
+    C2 = XOR5(A[2], A[7], A[12], A[17], A[22]);
+    C3 = XOR5(A[3], A[8], A[13], A[18], A[23]);
+    C4 = XOR5(A[4], A[9], A[14], A[19], A[24]);
+    D0 = _mm256_xor_si256(C4, ROL(C1, 1));
+    D1 = _mm256_xor_si256(C0, ROL(C2, 1));
+    D2 = _mm256_xor_si256(C1, ROL(C3, 1));
+    D3 = _mm256_xor_si256(C2, ROL(C4, 1));
+    D4 = _mm256_xor_si256(C3, ROL(C0, 1));
+
+    /* Rho and Pi */
+    B[0] = _mm256_xor_si256(A[0], D0);
+    B[10] = ROL(_mm256_xor_si256(A[1], D1), 1);
+    B[20] = ROL(_mm256_xor_si256(A[2], D2), 62);
+    B[5] = ROL(_mm256_xor_si256(A[3], D3), 28);
+    B[15] = ROL(_mm256_xor_si256(A[4], D4), 27);
+    B[16] = ROL(_mm256_xor_si256(A[5], D0), 36);
+    B[1] = ROL(_mm256_xor_si256(A[6], D1), 44);
+    B[11] = ROL(_mm256_xor_si256(A[7], D2), 6);
+    B[21] = ROL(_mm256_xor_si256(A[8], D3), 55);
+    B[6] = ROL(_mm256_xor_si256(A[9], D4), 20);
+    B[7] = ROL(_mm256_xor_si256(A[10], D0), 3);
+    B[17] = ROL(_mm256_xor_si256(A[11], D1), 10);
+    B[2] = ROL(_mm256_xor_si256(A[12], D2), 43);
+    B[12] = ROL(_mm256_xor_si256(A[13], D3), 25);
+    B[22] = ROL(_mm256_xor_si256(A[14], D4), 39);
+    B[23] = ROL(_mm256_xor_si256(A[15], D0), 41);
+    B[8] = ROL(_mm256_xor_si256(A[16], D1), 45);
+    B[18] = ROL(_mm256_xor_si256(A[17], D2), 15);
+    B[3] = ROL(_mm256_xor_si256(A[18], D3), 21);
+    B[13] = ROL(_mm256_xor_si256(A[19], D4), 8);
+    B[14] = ROL(_mm256_xor_si256(A[20], D0), 18);
+    B[24] = ROL(_mm256_xor_si256(A[21], D1), 2);
+    B[9] = ROL(_mm256_xor_si256(A[22], D2), 61);
+    B[19] = ROL(_mm256_xor_si256(A[23], D3), 56);
+    B[4] = ROL(_mm256_xor_si256(A[24], D4), 14);
+
+    /* Chi */
+    A[0] = CHI(B[0], B[1], B[2]);
+    A[1] = CHI(B[1], B[2], B[3]);
+    A[2] = CHI(B[2], B[3], B[4]);
+    A[3] = CHI(B[3], B[4], B[0]);
+    A[4] = CHI(B[4], B[0], B[1]);
+    A[5] = CHI(B[5], B[6], B[7]);
+    A[6] = CHI(B[6], B[7], B[8]);
+    A[7] = CHI(B[7], B[8], B[9]);
+    A[8] = CHI(B[8], B[9], B[5]);
+    A[9] = CHI(B[9], B[5], B[6]);
+    A[10] = CHI(B[10], B[11], B[12]);
+    A[11] = CHI(B[11], B[12], B[13]);
+    A[12] = CHI(B[12], B[13], B[14]);
+    A[13] = CHI(B[13], B[14], B[10]);
+    A[14] = CHI(B[14], B[10], B[11]);
+    A[15] = CHI(B[15], B[16], B[17]);
+    A[16] = CHI(B[16], B[17], B[18]);
+    A[17] = CHI(B[17], B[18], B[19]);
+    A[18] = CHI(B[18], B[19], B[15]);
+    A[19] = CHI(B[19], B[15], B[16]);
+    A[20] = CHI(B[20], B[21], B[22]);
+    A[21] = CHI(B[21], B[22], B[23]);
+    A[22] = CHI(B[22], B[23], B[24]);
+    A[23] = CHI(B[23], B[24], B[20]);
+    A[24] = CHI(B[24], B[20], B[21]);
+
+    /* Iota */
+    A[0] = _mm256_xor_si256(
+        A[0], _mm256_set1_epi64x((int64_t)KeccakF_RoundConstants[round]));
+  }
+
+  for (i = 0; i < 24; i += 4)
+  {
+    mld_transpose4x4(&A[i + 0], &A[i + 1], &A[i + 2], &A[i + 3]);
+    _mm256_storeu_si256((__m256i *)&state[0 * 25 + i], A[i + 0]);
+    _mm256_storeu_si256((__m256i *)&state[1 * 25 + i], A[i + 1]);
+    _mm256_storeu_si256((__m256i *)&state[2 * 25 + i], A[i + 2]);
+    _mm256_storeu_si256((__m256i *)&state[3 * 25 + i], A[i + 3]);
+  }
+  state[0 * 25 + 24] = (uint64_t)_mm256_extract_epi64(A[24], 0);
+  state[1 * 25 + 24] = (uint64_t)_mm256_extract_epi64(A[24], 1);
+  state[2 * 25 + 24] = (uint64_t)_mm256_extract_epi64(A[24], 2);
+  state[3 * 25 + 24] = (uint64_t)_mm256_extract_epi64(A[24], 3);
+}
+
+#else /* MLD_FIPS202_BACKEND_X86_64_AVX2 */
+
+MLD_EMPTY_CU(fips202_avx2_keccakx4)
+
+#endif /* !MLD_FIPS202_BACKEND_X86_64_AVX2 */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_API_H
+#define MLD_NATIVE_API_H
+
+/*
+ * Native arithmetic interface
+ *
+ * This header documents the functions a native backend may provide.
+ *
+ * A backend announces which primitives it replaces by defining
+ * MLD_USE_NATIVE_XXX, and then provides a static inline function
+ * XXX_native() with the signature documented below. The backend's
+ * metadata file includes this header after setting MLD_USE_NATIVE_XXX
+ * and before defining the functions, so that the compiler checks the
+ * signatures for consistency.
+ */
+
+#include <stdint.h>
+#include "../params.h"
+#include "../sys.h"
+
+#if defined(MLD_USE_NATIVE_NTT)
+/*************************************************
+ * Name:        ntt_native
+ *
+ * Description: Computes number-theoretic transform (NTT) of
+ *              a polynomial in place.
+ *
+ *              The input and output conventions are the same as for the
+ *              C function ntt(): The input is in normal order and
+ *              coefficient-wise bound by MLDSA_Q in absolute value.
+ *              The output is in bitreversed order and coefficient-wise
+ *              bound by MLD_NTT_BOUND in absolute value.
+ *
+ *              Callers make no further assumptions on the output, so any
+ *              representative within those bounds is acceptable.
+ *
+ * Arguments:   - int32_t p[MLDSA_N]: pointer to in/output polynomial
+ **************************************************/
+static MLD_INLINE void ntt_native(int32_t p[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_NTT */
+
+#if defined(MLD_USE_NATIVE_INTT)
+/*************************************************
+ * Name:        intt_native
+ *
+ * Description: Computes inverse of number-theoretic transform (NTT) of
+ *              a polynomial in place, including multiplication by the
+ *              Montgomery factor 2^32.
+ *
+ *              The input and output conventions are the same as for the
+ *              C function invntt_tomont(): The input is in bitreversed
+ *              order and coefficient-wise bound by MLDSA_Q in absolute
+ *              value. The output is in normal order and coefficient-wise
+ *              bound by MLDSA_Q in absolute value.
+ *
+ * Arguments:   - int32_t p[MLDSA_N]: pointer to in/output polynomial
+ **************************************************/
+static MLD_INLINE void intt_native(int32_t p[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_INTT */
+
+#if defined(MLD_USE_NATIVE_POINTWISE_MONTGOMERY)
+/*************************************************
+ * Name:        poly_pointwise_montgomery_native
+ *
+ * Description: Pointwise multiplication of polynomials in NTT domain,
+ *              with multiplication by 2^{-32}.
+ *
+ *              The inputs are coefficient-wise bound by MLD_NTT_BOUND
+ *              in absolute value. The output is coefficient-wise bound
+ *              by MLDSA_Q in absolute value.
+ *
+ * Arguments:   - int32_t out[MLDSA_N]: output polynomial
+ *              - const int32_t in0[MLDSA_N]: first input polynomial
+ *              - const int32_t in1[MLDSA_N]: second input polynomial
+ **************************************************/
+static MLD_INLINE void poly_pointwise_montgomery_native(
+    int32_t out[MLDSA_N], const int32_t in0[MLDSA_N],
+    const int32_t in1[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POINTWISE_MONTGOMERY */
+
+/*************************************************
+ * Name:        polyvecl_pointwise_acc_montgomery_l{4,5,7}_native
+ *
+ * Description: Pointwise multiply vectors of 4, 5 or 7 polynomials in
+ *              NTT domain, multiply by 2^{-32} and accumulate.
+ *
+ *              The entries of u are coefficient-wise bound by MLDSA_Q,
+ *              and the entries of v by MLD_NTT_BOUND in absolute value.
+ *              The output is coefficient-wise bound by MLDSA_L * MLDSA_Q
+ *              in absolute value, as for the C implementation.
+ *
+ *              Only the variant matching MLDSA_L is used.
+ *
+ * Arguments:   - int32_t w[MLDSA_N]: output polynomial
+ *              - const int32_t u[][MLDSA_N]: first input vector
+ *              - const int32_t v[][MLDSA_N]: second input vector
+ **************************************************/
+#if defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L4)
+static MLD_INLINE void polyvecl_pointwise_acc_montgomery_l4_native(
+    int32_t w[MLDSA_N], const int32_t u[4][MLDSA_N],
+    const int32_t v[4][MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L4 */
+
+#if defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L5)
+static MLD_INLINE void polyvecl_pointwise_acc_montgomery_l5_native(
+    int32_t w[MLDSA_N], const int32_t u[5][MLDSA_N],
+    const int32_t v[5][MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L5 */
+
+#if defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L7)
+static MLD_INLINE void polyvecl_pointwise_acc_montgomery_l7_native(
+    int32_t w[MLDSA_N], const int32_t u[7][MLDSA_N],
+    const int32_t v[7][MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L7 */
+
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+/*************************************************
+ * Name:        rej_uniform_native
+ *
+ * Description: Sample uniformly random coefficients in [0, MLDSA_Q-1] by
+ *              performing rejection sampling on array of random bytes.
+ *
+ *              The function may stop early and leave a remainder of
+ *              the buffer to the C implementation. It must consume a
+ *              multiple of 3 bytes, and report the number of bytes
+ *              consumed in *consumed.
+ *
+ * Arguments:   - int32_t *r: pointer to output array
+ *              - unsigned len: number of coefficients to be sampled
+ *              - const uint8_t *buf: array of random bytes
+ *              - unsigned buflen: length of array of random bytes
+ *              - unsigned *consumed: output, number of bytes consumed
+ *
+ * Returns number of sampled coefficients, at most len.
+ **************************************************/
+static MLD_INLINE unsigned rej_uniform_native(int32_t *r, unsigned len,
+                                              const uint8_t *buf,
+                                              unsigned buflen,
+                                              unsigned *consumed);
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM */
+
+/*************************************************
+ * Name:        rej_eta{2,4}_native
+ *
+ * Description: Sample uniformly random coefficients in [-2, 2] or
+ *              [-4, 4] by performing rejection sampling on the nibbles
+ *              of an array of random bytes.
+ *
+ *              The function may stop early and leave a remainder of
+ *              the buffer to the C implementation. It must consume
+ *              whole bytes, and report the number of bytes consumed
+ *              in *consumed.
+ *
+ *              Only the variant matching MLDSA_ETA is used.
+ *
+ * Arguments:   - int32_t *r: pointer to output array
+ *              - unsigned len: number of coefficients to be sampled
+ *              - const uint8_t *buf: array of random bytes
+ *              - unsigned buflen: length of array of random bytes
+ *              - unsigned *consumed: output, number of bytes consumed
+ *
+ * Returns number of sampled coefficients, at most len.
+ **************************************************/
+#if defined(MLD_USE_NATIVE_REJ_ETA2)
+static MLD_INLINE unsigned rej_eta2_native(int32_t *r, unsigned len,
+                                           const uint8_t *buf,
+                                           unsigned buflen,
+                                           unsigned *consumed);
+#endif /* MLD_USE_NATIVE_REJ_ETA2 */
+
+#if defined(MLD_USE_NATIVE_REJ_ETA4)
+static MLD_INLINE unsigned rej_eta4_native(int32_t *r, unsigned len,
+                                           const uint8_t *buf,
+                                           unsigned buflen,
+                                           unsigned *consumed);
+#endif /* MLD_USE_NATIVE_REJ_ETA4 */
+
+#endif /* !MLD_NATIVE_API_H */
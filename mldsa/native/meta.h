@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_META_H
+#define MLD_NATIVE_META_H
+
+/*
+ * Default arithmetic backend
+ *
+ * Selects the native backend for the target architecture, if any.
+ * If no backend is available, nothing is defined here and the
+ * C implementation is used throughout.
+ */
+
+#if defined(MLD_SYS_X86_64_AVX2)
+#include "x86_64/meta.h"
+#endif
+
+#endif /* !MLD_NATIVE_META_H */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_X86_64_META_H
+#define MLD_NATIVE_X86_64_META_H
+
+/* Identifier for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#define MLD_ARITH_BACKEND_X86_64_DEFAULT
+
+#define MLD_ARITH_BACKEND_NAME AVX2
+
+/* Set of primitives that this backend replaces */
+#define MLD_USE_NATIVE_NTT
+#define MLD_USE_NATIVE_INTT
+#define MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+#define MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L4
+#define MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L5
+#define MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L7
+#define MLD_USE_NATIVE_REJ_UNIFORM
+#define MLD_USE_NATIVE_REJ_ETA2
+#define MLD_USE_NATIVE_REJ_ETA4
+
+#if !defined(__ASSEMBLER__)
+#include "../api.h"
+#include "src/arith_native_x86_64.h"
+
+static MLD_INLINE void ntt_native(int32_t data[MLDSA_N]) { ntt_avx2(data); }
+
+static MLD_INLINE void intt_native(int32_t data[MLDSA_N])
+{
+  invntt_avx2(data);
+}
+
+static MLD_INLINE void poly_pointwise_montgomery_native(
+    int32_t out[MLDSA_N], const int32_t in0[MLDSA_N],
+    const int32_t in1[MLDSA_N])
+{
+  pointwise_avx2(out, in0, in1);
+}
+
+static MLD_INLINE void polyvecl_pointwise_acc_montgomery_l4_native(
+    int32_t w[MLDSA_N], const int32_t u[4][MLDSA_N],
+    const int32_t v[4][MLDSA_N])
+{
+  pointwise_acc_l4_avx2(w, u, v);
+}
+
+static MLD_INLINE void polyvecl_pointwise_acc_montgomery_l5_native(
+    int32_t w[MLDSA_N], const int32_t u[5][MLDSA_N],
+    const int32_t v[5][MLDSA_N])
+{
+  pointwise_acc_l5_avx2(w, u, v);
+}
+
+static MLD_INLINE void polyvecl_pointwise_acc_montgomery_l7_native(
+    int32_t w[MLDSA_N], const int32_t u[7][MLDSA_N],
+    const int32_t v[7][MLDSA_N])
+{
+  pointwise_acc_l7_avx2(w, u, v);
+}
+
+static MLD_INLINE unsigned rej_uniform_native(int32_t *r, unsigned len,
+                                              const uint8_t *buf,
+                                              unsigned buflen,
+                                              unsigned *consumed)
+{
+  return rej_uniform_avx2(r, len, buf, buflen, consumed);
+}
+
+static MLD_INLINE unsigned rej_eta2_native(int32_t *r, unsigned len,
+                                           const uint8_t *buf,
+                                           unsigned buflen,
+                                           unsigned *consumed)
+{
+  return rej_eta2_avx2(r, len, buf, buflen, consumed);
+}
+
+static MLD_INLINE unsigned rej_eta4_native(int32_t *r, unsigned len,
+                                           const uint8_t *buf,
+                                           unsigned buflen,
+                                           unsigned *consumed)
+{
+  return rej_eta4_avx2(r, len, buf, buflen, consumed);
+}
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_NATIVE_X86_64_META_H */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+#define MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+
+#include <stdint.h>
+#include "../../../params.h"
+#include "../../../sys.h"
+#include "consts.h"
+
+#define ntt_avx2 MLD_NAMESPACE(ntt_avx2)
+/*************************************************
+ * Name:        ntt_avx2
+ *
+ * Description: AVX2 implementation of the forward NTT.
+ *
+ *              Layers 1-3 and layers 4-8 are merged and computed
+ *              in registers, using 8-lane Montgomery multiplication.
+ *              Input and output are in the same order as for the
+ *              C implementation, and the output is identical to it.
+ *
+ * Arguments:   - int32_t a[MLDSA_N]: pointer to in/output polynomial
+ **************************************************/
+void ntt_avx2(int32_t a[MLDSA_N]);
+
+#define invntt_avx2 MLD_NAMESPACE(invntt_avx2)
+/*************************************************
+ * Name:        invntt_avx2
+ *
+ * Description: AVX2 implementation of the inverse NTT with
+ *              multiplication by the Montgomery factor 2^32.
+ *
+ *              Layers 8-4 and layers 3-1 are merged and computed
+ *              in registers. The final scaling by mont^2/256 is
+ *              folded into layer 1. Input and output are in the same
+ *              order and satisfy the same bounds as for the C
+ *              implementation.
+ *
+ * Arguments:   - int32_t a[MLDSA_N]: pointer to in/output polynomial
+ **************************************************/
+void invntt_avx2(int32_t a[MLDSA_N]);
+
+#define pointwise_avx2 MLD_NAMESPACE(pointwise_avx2)
+/*************************************************
+ * Name:        pointwise_avx2
+ *
+ * Description: AVX2 implementation of the pointwise multiplication
+ *              of two polynomials in NTT domain, with multiplication
+ *              by 2^{-32}.
+ *
+ * Arguments:   - int32_t c[MLDSA_N]: output polynomial
+ *              - const int32_t a[MLDSA_N]: first input polynomial
+ *              - const int32_t b[MLDSA_N]: second input polynomial
+ **************************************************/
+void pointwise_avx2(int32_t c[MLDSA_N], const int32_t a[MLDSA_N],
+                    const int32_t b[MLDSA_N]);
+
+#define pointwise_acc_l4_avx2 MLD_NAMESPACE(pointwise_acc_l4_avx2)
+#define pointwise_acc_l5_avx2 MLD_NAMESPACE(pointwise_acc_l5_avx2)
+#define pointwise_acc_l7_avx2 MLD_NAMESPACE(pointwise_acc_l7_avx2)
+/*************************************************
+ * Name:        pointwise_acc_l{4,5,7}_avx2
+ *
+ * Description: AVX2 implementation of the pointwise multiply-accumulate
+ *              of two vectors of 4, 5 or 7 polynomials in NTT domain,
+ *              with multiplication by 2^{-32}.
+ *
+ *              Products are accumulated in 64-bit lanes, and every
+ *              output coefficient is reduced once.
+ *
+ * Arguments:   - int32_t c[MLDSA_N]: output polynomial
+ *              - const int32_t a[][MLDSA_N]: first input vector
+ *              - const int32_t b[][MLDSA_N]: second input vector
+ **************************************************/
+void pointwise_acc_l4_avx2(int32_t c[MLDSA_N], const int32_t a[4][MLDSA_N],
+                           const int32_t b[4][MLDSA_N]);
+void pointwise_acc_l5_avx2(int32_t c[MLDSA_N], const int32_t a[5][MLDSA_N],
+                           const int32_t b[5][MLDSA_N]);
+void pointwise_acc_l7_avx2(int32_t c[MLDSA_N], const int32_t a[7][MLDSA_N],
+                           const int32_t b[7][MLDSA_N]);
+
+#define rej_uniform_table MLD_NAMESPACE(rej_uniform_table)
+extern const uint8_t rej_uniform_table[256][8];
+
+/*************************************************
+ * Name:        mld_popcount8
+ *
+ * Description: Number of bits set in an 8-bit mask, e.g. the number of
+ *              coefficients accepted by one row of rej_uniform_table.
+ *              Computed with plain integer arithmetic, so that the
+ *              backend only depends on AVX2 and not on POPCNT.
+ *
+ * Arguments:   - unsigned m: mask in [0, 255]
+ **************************************************/
+static MLD_INLINE unsigned mld_popcount8(unsigned m)
+{
+  m = m - ((m >> 1) & 0x55);
+  m = (m & 0x33) + ((m >> 2) & 0x33);
+  return (m + (m >> 4)) & 0x0F;
+}
+
+#define rej_uniform_avx2 MLD_NAMESPACE(rej_uniform_avx2)
+/*************************************************
+ * Name:        rej_uniform_avx2
+ *
+ * Description: AVX2 implementation of the rejection sampling of
+ *              coefficients in [0, MLDSA_Q-1], see rej_uniform().
+ *
+ *              The buffer is processed in chunks of 24 bytes, which
+ *              are masked to 23 bits per coefficient and compared
+ *              against MLDSA_Q in parallel. The accepted coefficients
+ *              are compacted using rej_uniform_table.
+ *
+ *              Stops when fewer than 8 coefficients remain to be
+ *              sampled, or fewer than 32 bytes remain in the buffer.
+ *              The remainder is left to the caller.
+ *
+ * Arguments:   - int32_t *r: pointer to output array
+ *              - unsigned len: number of coefficients to be sampled
+ *              - const uint8_t *buf: array of random bytes
+ *              - unsigned buflen: length of array of random bytes
+ *              - unsigned *consumed: output, number of bytes consumed
+ *
+ * Returns number of sampled coefficients.
+ **************************************************/
+unsigned rej_uniform_avx2(int32_t *r, unsigned len, const uint8_t *buf,
+                          unsigned buflen, unsigned *consumed);
+
+#define rej_eta2_avx2 MLD_NAMESPACE(rej_eta2_avx2)
+#define rej_eta4_avx2 MLD_NAMESPACE(rej_eta4_avx2)
+/*************************************************
+ * Name:        rej_eta{2,4}_avx2
+ *
+ * Description: AVX2 implementation of the rejection sampling of
+ *              coefficients in [-2, 2] or [-4, 4], see rej_eta().
+ *
+ *              Stops when fewer than 8 coefficients remain to be
+ *              sampled, or fewer than 16 bytes remain in the buffer.
+ *              The remainder is left to the caller.
+ *
+ * Arguments:   - int32_t *r: pointer to output array
+ *              - unsigned len: number of coefficients to be sampled
+ *              - const uint8_t *buf: array of random bytes
+ *              - unsigned buflen: length of array of random bytes
+ *              - unsigned *consumed: output, number of bytes consumed
+ *
+ * Returns number of sampled coefficients.
+ **************************************************/
+unsigned rej_eta2_avx2(int32_t *r, unsigned len, const uint8_t *buf,
+                       unsigned buflen, unsigned *consumed);
+unsigned rej_eta4_avx2(int32_t *r, unsigned len, const uint8_t *buf,
+                       unsigned buflen, unsigned *consumed);
+
+#endif /* !MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H */
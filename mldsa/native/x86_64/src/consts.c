@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <stdint.h>
+#include "consts.h"
+
+MLD_ALIGN const int32_t ntt_avx2_zetas[] = {
+#include "x86_64_zetas.i"
+};
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+MLD_EMPTY_CU(avx2_consts)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_NATIVE_X86_64_SRC_CONSTS_H
+#define MLD_NATIVE_X86_64_SRC_CONSTS_H
+
+#include <stdint.h>
+#include "../../../params.h"
+
+/* check-magic: 58728449 == unsigned_mod(pow(MLDSA_Q, -1, 2^32), 2^32) */
+#define MLD_AVX2_QINV 58728449
+
+/* Offsets into ntt_avx2_zetas, in units of int32_t. See autogen. */
+#define MLD_AVX2_ZETAS_QINV_L15 0
+#define MLD_AVX2_ZETAS_L15 32
+#define MLD_AVX2_ZETAS_L678 64
+#define MLD_AVX2_INVZETAS_QINV_L15 832
+#define MLD_AVX2_INVZETAS_L15 864
+#define MLD_AVX2_INVZETAS_L876 896
+/* mont^2/256 and its product with the layer-1 twiddle, for the
+ * last layer of the invNTT */
+#define MLD_AVX2_INVZETAS_QINV_F 1664
+#define MLD_AVX2_INVZETAS_F 1666
+
+#define ntt_avx2_zetas MLD_NAMESPACE(ntt_avx2_zetas)
+extern const int32_t ntt_avx2_zetas[];
+
+#endif /* !MLD_NATIVE_X86_64_SRC_CONSTS_H */
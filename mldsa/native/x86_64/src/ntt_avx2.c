@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+#include "consts.h"
+
+/*************************************************
+ * Name:        mld_mulmont_avx2
+ *
+ * Description: Lane-wise Montgomery multiplication of 8 signed 32-bit
+ *              coefficients by 8 signed 32-bit twiddles.
+ *
+ *              Computes the same values as montgomery_reduce(a * b):
+ *              the 64-bit products are formed separately for even and
+ *              odd lanes, and the high halves recombined at the end.
+ *
+ * Arguments:   - __m256i a:     coefficients
+ *              - __m256i b:     twiddles
+ *              - __m256i bqinv: twiddles multiplied by q^{-1} mod 2^32
+ **************************************************/
+static MLD_INLINE __m256i mld_mulmont_avx2(__m256i a, __m256i b,
+                                           __m256i bqinv)
+{
+  const __m256i q = _mm256_set1_epi32(MLDSA_Q);
+  __m256i a_odd, b_odd, bqinv_odd, t_even, t_odd, p_even, p_odd;
+
+  a_odd = _mm256_srli_epi64(a, 32);
+  b_odd = _mm256_srli_epi64(b, 32);
+  bqinv_odd = _mm256_srli_epi64(bqinv, 32);
+
+  /* t = (a * b * q^{-1}) mod 2^32, in the low halves */
+  t_even = _mm256_mul_epi32(a, bqinv);
+  t_odd = _mm256_mul_epi32(a_odd, bqinv_odd);
+  p_even = _mm256_mul_epi32(a, b);
+  p_odd = _mm256_mul_epi32(a_odd, b_odd);
+  t_even = _mm256_mul_epi32(t_even, q);
+  t_odd = _mm256_mul_epi32(t_odd, q);
+
+  /* a * b - t * q has vanishing low half; the result is the high half */
+  p_even = _mm256_sub_epi64(p_even, t_even);
+  p_odd = _mm256_sub_epi64(p_odd, t_odd);
+  p_even = _mm256_srli_epi64(p_even, 32);
+  return _mm256_blend_epi32(p_even, p_odd, 0xAA);
+}
+
+/* Cooley-Tukey butterfly with Montgomery multiplication, as in
+ * mld_ntt_butterfly_block() */
+#define MLD_CT_BUTTERFLY(a, b, z, zqinv)        \
+  do                                            \
+  {                                             \
+    __m256i t_ = mld_mulmont_avx2(b, z, zqinv); \
+    b = _mm256_sub_epi32(a, t_);                \
+    a = _mm256_add_epi32(a, t_);                \
+  } while (0)
+
+/* Gentleman-Sande butterfly with Montgomery multiplication, as in
+ * mld_invntt_layer(). The twiddle z is the negated zeta. */
+#define MLD_GS_BUTTERFLY(a, b, z, zqinv)                       \
+  do                                                           \
+  {                                                            \
+    __m256i t_ = a;                                            \
+    a = _mm256_add_epi32(t_, b);                               \
+    b = mld_mulmont_avx2(_mm256_sub_epi32(t_, b), z, zqinv);   \
+  } while (0)
+
+/* Broadcast the twiddle of index k in zetas[] and its premultiplied
+ * counterpart. Only used for layers 1-5. */
+#define MLD_ZETA(k) _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_ZETAS_L15 + (k)])
+#define MLD_ZETA_QINV(k) \
+  _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_ZETAS_QINV_L15 + (k)])
+
+/* As MLD_ZETA() and MLD_ZETA_QINV(), but for -zetas[k] */
+#define MLD_INVZETA(k) \
+  _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_INVZETAS_L15 + (k)])
+#define MLD_INVZETA_QINV(k) \
+  _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_INVZETAS_QINV_L15 + (k)])
+
+/*************************************************
+ * Name:        mld_ntt_avx2_layer123
+ *
+ * Description: Computes layers 1, 2 and 3 of the forward NTT on the
+ *              8 vectors with index i, i+4, ..., i+28, which are
+ *              independent of all other vectors in those layers.
+ **************************************************/
+static void mld_ntt_avx2_layer123(int32_t a[MLDSA_N], unsigned i)
+{
+  __m256i r[8], z, zq;
+  unsigned m;
+
+  for (m = 0; m < 8; m++)
+  {
+    r[m] = _mm256_loadu_si256((const __m256i *)&a[8 * (i + 4 * m)]);
+  }
+
+  /* Layer 1: distance 128 */
+  z = MLD_ZETA(1);
+  zq = MLD_ZETA_QINV(1);
+  MLD_CT_BUTTERFLY(r[0], r[4], z, zq);
+  MLD_CT_BUTTERFLY(r[1], r[5], z, zq);
+  MLD_CT_BUTTERFLY(r[2], r[6], z, zq);
+  MLD_CT_BUTTERFLY(r[3], r[7], z, zq);
+
+  /* Layer 2: distance 64 */
+  z = MLD_ZETA(2);
+  zq = MLD_ZETA_QINV(2);
+  MLD_CT_BUTTERFLY(r[0], r[2], z, zq);
+  MLD_CT_BUTTERFLY(r[1], r[3], z, zq);
+  z = MLD_ZETA(3);
+  zq = MLD_ZETA_QINV(3);
+  MLD_CT_BUTTERFLY(r[4], r[6], z, zq);
+  MLD_CT_BUTTERFLY(r[5], r[7], z, zq);
+
+  /* Layer 3: distance 32 */
+  for (m = 0; m < 4; m++)
+  {
+    z = MLD_ZETA(4 + m);
+    zq = MLD_ZETA_QINV(4 + m);
+    MLD_CT_BUTTERFLY(r[2 * m], r[2 * m + 1], z, zq);
+  }
+
+  for (m = 0; m < 8; m++)
+  {
+    _mm256_storeu_si256((__m256i *)&a[8 * (i + 4 * m)], r[m]);
+  }
+}
+
+/*************************************************
+ * Name:        mld_ntt_avx2_layer678
+ *
+ * Description: Computes layers 6, 7 and 8 of the forward NTT on
+ *              a pair of consecutive vectors, with butterflies
+ *              operating within vectors.
+ *
+ *              Before each layer, the coefficients are shuffled
+ *              so that butterfly partners are in the same lane of
+ *              x and y. After layer 8, the original order is restored.
+ *
+ * Arguments:   - __m256i *a, *b: pointers to the pair of vectors
+ *              - const int32_t *zetas: pointer to the twiddles for
+ *                this pair of vectors (layers 6, 7, 8, each as
+ *                premultiplied and plain vector)
+ **************************************************/
+static MLD_INLINE void mld_ntt_avx2_layer678(__m256i *a, __m256i *b,
+                                             const int32_t *zetas)
+{
+  __m256i x, y, t, z, zq;
+
+  /* Layer 6: distance 4
+   * x = a0 a1 a2 a3 | b0 b1 b2 b3
+   * y = a4 a5 a6 a7 | b4 b5 b6 b7 */
+  x = _mm256_permute2x128_si256(*a, *b, 0x20);
+  y = _mm256_permute2x128_si256(*a, *b, 0x31);
+  zq = _mm256_load_si256((const __m256i *)(zetas + 0));
+  z = _mm256_load_si256((const __m256i *)(zetas + 8));
+  MLD_CT_BUTTERFLY(x, y, z, zq);
+
+  /* Layer 7: distance 2
+   * x = a0 a1 a4 a5 | b0 b1 b4 b5
+   * y = a2 a3 a6 a7 | b2 b3 b6 b7 */
+  t = _mm256_unpacklo_epi64(x, y);
+  y = _mm256_unpackhi_epi64(x, y);
+  x = t;
+  zq = _mm256_load_si256((const __m256i *)(zetas + 16));
+  z = _mm256_load_si256((const __m256i *)(zetas + 24));
+  MLD_CT_BUTTERFLY(x, y, z, zq);
+
+  /* Layer 8: distance 1
+   * x = a0 a2 a4 a6 | b0 b2 b4 b6
+   * y = a1 a3 a5 a7 | b1 b3 b5 b7 */
+  t = _mm256_blend_epi32(x, _mm256_slli_epi64(y, 32), 0xAA);
+  y = _mm256_blend_epi32(_mm256_srli_epi64(x, 32), y, 0xAA);
+  x = t;
+  zq = _mm256_load_si256((const __m256i *)(zetas + 32));
+  z = _mm256_load_si256((const __m256i *)(zetas + 40));
+  MLD_CT_BUTTERFLY(x, y, z, zq);
+
+  /* Restore natural order */
+  t = _mm256_unpacklo_epi32(x, y);
+  y = _mm256_unpackhi_epi32(x, y);
+  *a = _mm256_permute2x128_si256(t, y, 0x20);
+  *b = _mm256_permute2x128_si256(t, y, 0x31);
+}
+
+/*************************************************
+ * Name:        mld_ntt_avx2_layer45678
+ *
+ * Description: Computes layers 4 to 8 of the forward NTT on the
+ *              4 consecutive vectors with index 4*j, ..., 4*j+3,
+ *              that is, on coefficients 32*j, ..., 32*j+31.
+ **************************************************/
+static void mld_ntt_avx2_layer45678(int32_t a[MLDSA_N], unsigned j)
+{
+  __m256i r0, r1, r2, r3, z, zq;
+  const int32_t *zetas = ntt_avx2_zetas + MLD_AVX2_ZETAS_L678 + 96 * j;
+
+  r0 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 0]);
+  r1 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 8]);
+  r2 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 16]);
+  r3 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 24]);
+
+  /* Layer 4: distance 16 */
+  z = MLD_ZETA(8 + j);
+  zq = MLD_ZETA_QINV(8 + j);
+  MLD_CT_BUTTERFLY(r0, r2, z, zq);
+  MLD_CT_BUTTERFLY(r1, r3, z, zq);
+
+  /* Layer 5: distance 8 */
+  z = MLD_ZETA(16 + 2 * j);
+  zq = MLD_ZETA_QINV(16 + 2 * j);
+  MLD_CT_BUTTERFLY(r0, r1, z, zq);
+  z = MLD_ZETA(17 + 2 * j);
+  zq = MLD_ZETA_QINV(17 + 2 * j);
+  MLD_CT_BUTTERFLY(r2, r3, z, zq);
+
+  /* Layers 6-8: distances 4, 2, 1 */
+  mld_ntt_avx2_layer678(&r0, &r1, zetas);
+  mld_ntt_avx2_layer678(&r2, &r3, zetas + 48);
+
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 0], r0);
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 8], r1);
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 16], r2);
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 24], r3);
+}
+
+void ntt_avx2(int32_t a[MLDSA_N])
+{
+  unsigned i;
+
+  for (i = 0; i < 4; i++)
+  {
+    mld_ntt_avx2_layer123(a, i);
+  }
+
+  for (i = 0; i < 8; i++)
+  {
+    mld_ntt_avx2_layer45678(a, i);
+  }
+}
+
+/*************************************************
+ * Name:        mld_invntt_avx2_layer876
+ *
+ * Description: Computes layers 8, 7 and 6 of the inverse NTT on
+ *              a pair of consecutive vectors, with butterflies
+ *              operating within vectors.
+ *
+ *              The shuffles are the inverses of those in
+ *              mld_ntt_avx2_layer678(), so that butterfly partners
+ *              are in the same lane of x and y, and the coefficients
+ *              are back in their original order after layer 6.
+ *
+ * Arguments:   - __m256i *a, *b: pointers to the pair of vectors
+ *              - const int32_t *zetas: pointer to the twiddles for
+ *                this pair of vectors (layers 8, 7, 6, each as
+ *                premultiplied and plain vector)
+ **************************************************/
+static MLD_INLINE void mld_invntt_avx2_layer876(__m256i *a, __m256i *b,
+                                                const int32_t *zetas)
+{
+  __m256i x, y, t, z, zq;
+
+  /* Layer 8: distance 1
+   * x = a0 a2 a4 a6 | b0 b2 b4 b6
+   * y = a1 a3 a5 a7 | b1 b3 b5 b7 */
+  t = _mm256_permute2x128_si256(*a, *b, 0x20);
+  y = _mm256_permute2x128_si256(*a, *b, 0x31);
+  x = _mm256_castps_si256(_mm256_shuffle_ps(
+      _mm256_castsi256_ps(t), _mm256_castsi256_ps(y), _MM_SHUFFLE(2, 0, 2, 0)));
+  y = _mm256_castps_si256(_mm256_shuffle_ps(
+      _mm256_castsi256_ps(t), _mm256_castsi256_ps(y), _MM_SHUFFLE(3, 1, 3, 1)));
+  zq = _mm256_load_si256((const __m256i *)(zetas + 0));
+  z = _mm256_load_si256((const __m256i *)(zetas + 8));
+  MLD_GS_BUTTERFLY(x, y, z, zq);
+
+  /* Layer 7: distance 2
+   * x = a0 a1 a4 a5 | b0 b1 b4 b5
+   * y = a2 a3 a6 a7 | b2 b3 b6 b7 */
+  t = _mm256_blend_epi32(x, _mm256_slli_epi64(y, 32), 0xAA);
+  y = _mm256_blend_epi32(_mm256_srli_epi64(x, 32), y, 0xAA);
+  x = t;
+  zq = _mm256_load_si256((const __m256i *)(zetas + 16));
+  z = _mm256_load_si256((const __m256i *)(zetas + 24));
+  MLD_GS_BUTTERFLY(x, y, z, zq);
+
+  /* Layer 6: distance 4
+   * x = a0 a1 a2 a3 | b0 b1 b2 b3
+   * y = a4 a5 a6 a7 | b4 b5 b6 b7 */
+  t = _mm256_unpacklo_epi64(x, y);
+  y = _mm256_unpackhi_epi64(x, y);
+  x = t;
+  zq = _mm256_load_si256((const __m256i *)(zetas + 32));
+  z = _mm256_load_si256((const __m256i *)(zetas + 40));
+  MLD_GS_BUTTERFLY(x, y, z, zq);
+
+  /* Restore natural order */
+  *a = _mm256_permute2x128_si256(x, y, 0x20);
+  *b = _mm256_permute2x128_si256(x, y, 0x31);
+}
+
+/*************************************************
+ * Name:        mld_invntt_avx2_layer87654
+ *
+ * Description: Computes layers 8 to 4 of the inverse NTT on the
+ *              4 consecutive vectors with index 4*j, ..., 4*j+3,
+ *              that is, on coefficients 32*j, ..., 32*j+31.
+ **************************************************/
+static void mld_invntt_avx2_layer87654(int32_t a[MLDSA_N], unsigned j)
+{
+  __m256i r0, r1, r2, r3, z, zq;
+  const int32_t *zetas = ntt_avx2_zetas + MLD_AVX2_INVZETAS_L876 + 96 * j;
+
+  r0 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 0]);
+  r1 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 8]);
+  r2 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 16]);
+  r3 = _mm256_loadu_si256((const __m256i *)&a[32 * j + 24]);
+
+  /* Layers 8-6: distances 1, 2, 4 */
+  mld_invntt_avx2_layer876(&r0, &r1, zetas);
+  mld_invntt_avx2_layer876(&r2, &r3, zetas + 48);
+
+  /* Layer 5: distance 8 */
+  z = MLD_INVZETA(31 - 2 * j);
+  zq = MLD_INVZETA_QINV(31 - 2 * j);
+  MLD_GS_BUTTERFLY(r0, r1, z, zq);
+  z = MLD_INVZETA(30 - 2 * j);
+  zq = MLD_INVZETA_QINV(30 - 2 * j);
+  MLD_GS_BUTTERFLY(r2, r3, z, zq);
+
+  /* Layer 4: distance 16 */
+  z = MLD_INVZETA(15 - j);
+  zq = MLD_INVZETA_QINV(15 - j);
+  MLD_GS_BUTTERFLY(r0, r2, z, zq);
+  MLD_GS_BUTTERFLY(r1, r3, z, zq);
+
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 0], r0);
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 8], r1);
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 16], r2);
+  _mm256_storeu_si256((__m256i *)&a[32 * j + 24], r3);
+}
+
+/*************************************************
+ * Name:        mld_invntt_avx2_layer321
+ *
+ * Description: Computes layers 3, 2 and 1 of the inverse NTT on the
+ *              8 vectors with index i, i+4, ..., i+28, followed by
+ *              the multiplication by mont^2/256.
+ *
+ *              The scaling is folded into layer 1: the sums are
+ *              multiplied by f = mont^2/256, and the differences by
+ *              the precomputed Montgomery product of f and -zetas[1].
+ **************************************************/
+static void mld_invntt_avx2_layer321(int32_t a[MLDSA_N], unsigned i)
+{
+  __m256i r[8], z, zq, f, fq, fz, fzq, t;
+  unsigned m;
+
+  for (m = 0; m < 8; m++)
+  {
+    r[m] = _mm256_loadu_si256((const __m256i *)&a[8 * (i + 4 * m)]);
+  }
+
+  /* Layer 3: distance 32 */
+  for (m = 0; m < 4; m++)
+  {
+    z = MLD_INVZETA(7 - m);
+    zq = MLD_INVZETA_QINV(7 - m);
+    MLD_GS_BUTTERFLY(r[2 * m], r[2 * m + 1], z, zq);
+  }
+
+  /* Layer 2: distance 64 */
+  z = MLD_INVZETA(3);
+  zq = MLD_INVZETA_QINV(3);
+  MLD_GS_BUTTERFLY(r[0], r[2], z, zq);
+  MLD_GS_BUTTERFLY(r[1], r[3], z, zq);
+  z = MLD_INVZETA(2);
+  zq = MLD_INVZETA_QINV(2);
+  MLD_GS_BUTTERFLY(r[4], r[6], z, zq);
+  MLD_GS_BUTTERFLY(r[5], r[7], z, zq);
+
+  /* Layer 1: distance 128, including the scaling by mont^2/256 */
+  fq = _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_INVZETAS_QINV_F + 0]);
+  fzq = _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_INVZETAS_QINV_F + 1]);
+  f = _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_INVZETAS_F + 0]);
+  fz = _mm256_set1_epi32(ntt_avx2_zetas[MLD_AVX2_INVZETAS_F + 1]);
+  for (m = 0; m < 4; m++)
+  {
+    t = _mm256_add_epi32(r[m], r[m + 4]);
+    r[m + 4] = _mm256_sub_epi32(r[m], r[m + 4]);
+    r[m] = mld_mulmont_avx2(t, f, fq);
+    r[m + 4] = mld_mulmont_avx2(r[m + 4], fz, fzq);
+  }
+
+  for (m = 0; m < 8; m++)
+  {
+    _mm256_storeu_si256((__m256i *)&a[8 * (i + 4 * m)], r[m]);
+  }
+}
+
+void invntt_avx2(int32_t a[MLDSA_N])
+{
+  unsigned i;
+
+  for (i = 0; i < 8; i++)
+  {
+    mld_invntt_avx2_layer87654(a, i);
+  }
+
+  for (i = 0; i < 4; i++)
+  {
+    mld_invntt_avx2_layer321(a, i);
+  }
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+MLD_EMPTY_CU(avx2_ntt)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+#include "consts.h"
+
+/*************************************************
+ * Name:        mld_montgomery_reduce_avx2
+ *
+ * Description: Montgomery reduction of 8 signed 64-bit values, given
+ *              as two vectors holding the values for the even and odd
+ *              lanes, respectively.
+ *
+ *              Computes the same values as montgomery_reduce().
+ *
+ * Arguments:   - __m256i even: 64-bit values for lanes 0, 2, 4, 6
+ *              - __m256i odd:  64-bit values for lanes 1, 3, 5, 7
+ *
+ * Returns the 8 reduced 32-bit values, in natural lane order.
+ **************************************************/
+static MLD_INLINE __m256i mld_montgomery_reduce_avx2(__m256i even, __m256i odd)
+{
+  const __m256i q = _mm256_set1_epi32(MLDSA_Q);
+  const __m256i qinv = _mm256_set1_epi32(MLD_AVX2_QINV);
+  __m256i t_even, t_odd;
+
+  /* t = (a * q^{-1}) mod 2^32, in the low halves */
+  t_even = _mm256_mul_epi32(even, qinv);
+  t_odd = _mm256_mul_epi32(odd, qinv);
+  t_even = _mm256_mul_epi32(t_even, q);
+  t_odd = _mm256_mul_epi32(t_odd, q);
+
+  /* a - t * q has vanishing low half; the result is the high half */
+  even = _mm256_sub_epi64(even, t_even);
+  odd = _mm256_sub_epi64(odd, t_odd);
+  even = _mm256_srli_epi64(even, 32);
+  return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+/*************************************************
+ * Name:        mld_pointwise_acc_avx2
+ *
+ * Description: Computes sum_i a[i] * b[i] * 2^{-32} for polynomials
+ *              in NTT domain.
+ *
+ *              The products are accumulated in 64-bit lanes and reduced
+ *              once per output coefficient. For |a[i]| < MLDSA_Q and
+ *              |b[i]| < MLD_NTT_BOUND, the sum stays within the input
+ *              bound of montgomery_reduce() for l <= 7.
+ *
+ * Arguments:   - int32_t c[MLDSA_N]: output polynomial
+ *              - const int32_t *a, *b: l consecutive input polynomials
+ *              - unsigned l: number of polynomials
+ **************************************************/
+static MLD_INLINE void mld_pointwise_acc_avx2(int32_t c[MLDSA_N],
+                                              const int32_t *a,
+                                              const int32_t *b, unsigned l)
+{
+  __m256i x, y, even, odd;
+  unsigned i, j;
+
+  for (i = 0; i < MLDSA_N; i += 8)
+  {
+    even = _mm256_setzero_si256();
+    odd = _mm256_setzero_si256();
+    for (j = 0; j < l; j++)
+    {
+      x = _mm256_loadu_si256((const __m256i *)&a[j * MLDSA_N + i]);
+      y = _mm256_loadu_si256((const __m256i *)&b[j * MLDSA_N + i]);
+      even = _mm256_add_epi64(even, _mm256_mul_epi32(x, y));
+      x = _mm256_srli_epi64(x, 32);
+      y = _mm256_srli_epi64(y, 32);
+      odd = _mm256_add_epi64(odd, _mm256_mul_epi32(x, y));
+    }
+    _mm256_storeu_si256((__m256i *)&c[i],
+                        mld_montgomery_reduce_avx2(even, odd));
+  }
+}
+
+void pointwise_avx2(int32_t c[MLDSA_N], const int32_t a[MLDSA_N],
+                    const int32_t b[MLDSA_N])
+{
+  mld_pointwise_acc_avx2(c, a, b, 1);
+}
+
+void pointwise_acc_l4_avx2(int32_t c[MLDSA_N], const int32_t a[4][MLDSA_N],
+                           const int32_t b[4][MLDSA_N])
+{
+  mld_pointwise_acc_avx2(c, &a[0][0], &b[0][0], 4);
+}
+
+void pointwise_acc_l5_avx2(int32_t c[MLDSA_N], const int32_t a[5][MLDSA_N],
+                           const int32_t b[5][MLDSA_N])
+{
+  mld_pointwise_acc_avx2(c, &a[0][0], &b[0][0], 5);
+}
+
+void pointwise_acc_l7_avx2(int32_t c[MLDSA_N], const int32_t a[7][MLDSA_N],
+                           const int32_t b[7][MLDSA_N])
+{
+  mld_pointwise_acc_avx2(c, &a[0][0], &b[0][0], 7);
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+MLD_EMPTY_CU(avx2_pointwise)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
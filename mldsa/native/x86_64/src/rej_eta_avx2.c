@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+/*************************************************
+ * Name:        mld_rej_eta_avx2
+ *
+ * Description: Rejection sampling of coefficients in [-eta, eta] from
+ *              the nibbles of a byte buffer, see rej_eta().
+ *
+ *              16 bytes are expanded into 32 nibbles at a time, in
+ *              the order in which rej_eta() processes them. Nibbles
+ *              are filtered with a vector compare, mapped to [-eta, eta]
+ *              and compacted in groups of 8 using rej_uniform_table.
+ *
+ *              Stops when fewer than 8 coefficients remain to be
+ *              sampled, or fewer than 16 bytes remain in the buffer.
+ *              The bytes consumed are always a multiple of 4.
+ **************************************************/
+static MLD_INLINE unsigned mld_rej_eta_avx2(int32_t *r, unsigned len,
+                                            const uint8_t *buf,
+                                            unsigned buflen,
+                                            unsigned *consumed, int eta)
+{
+  unsigned ctr, pos, good, g, m;
+  __m256i f0, f1;
+  __m128i h, idx;
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  const __m256i bound = _mm256_set1_epi8(eta == 2 ? 15 : 9);
+  const __m256i veta = _mm256_set1_epi8((char)eta);
+  const __m256i four = _mm256_set1_epi8(4);
+  const __m256i five = _mm256_set1_epi8(5);
+
+  ctr = pos = 0;
+  while (ctr + 8 <= len && pos + 16 <= buflen)
+  {
+    /* Byte 2*i holds the low nibble of buf[pos + i],
+     * byte 2*i + 1 holds the high nibble. */
+    f0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&buf[pos]));
+    f1 = _mm256_slli_epi16(f0, 4);
+    f0 = _mm256_or_si256(f0, f1);
+    f0 = _mm256_and_si256(f0, nibble);
+
+    good = (unsigned)_mm256_movemask_epi8(_mm256_cmpgt_epi8(bound, f0));
+
+    if (eta == 2)
+    {
+      /* t mod 5 for t < 15, by conditionally subtracting 5 twice */
+      f1 = _mm256_and_si256(_mm256_cmpgt_epi8(f0, four), five);
+      f0 = _mm256_sub_epi8(f0, f1);
+      f1 = _mm256_and_si256(_mm256_cmpgt_epi8(f0, four), five);
+      f0 = _mm256_sub_epi8(f0, f1);
+    }
+    f0 = _mm256_sub_epi8(veta, f0);
+
+    for (g = 0; g < 4; g++)
+    {
+      if (ctr + 8 > len)
+      {
+        break;
+      }
+
+      h = (g < 2) ? _mm256_castsi256_si128(f0)
+                  : _mm256_extracti128_si256(f0, 1);
+      if (g & 1)
+      {
+        h = _mm_bsrli_si128(h, 8);
+      }
+
+      m = (good >> (8 * g)) & 0xFF;
+      idx = _mm_loadl_epi64((const __m128i *)&rej_uniform_table[m][0]);
+      h = _mm_shuffle_epi8(h, idx);
+      _mm256_storeu_si256((__m256i *)&r[ctr], _mm256_cvtepi8_epi32(h));
+      ctr += mld_popcount8(m);
+      pos += 4;
+    }
+  }
+
+  *consumed = pos;
+  return ctr;
+}
+
+unsigned rej_eta2_avx2(int32_t *r, unsigned len, const uint8_t *buf,
+                       unsigned buflen, unsigned *consumed)
+{
+  return mld_rej_eta_avx2(r, len, buf, buflen, consumed, 2);
+}
+
+unsigned rej_eta4_avx2(int32_t *r, unsigned len, const uint8_t *buf,
+                       unsigned buflen, unsigned *consumed)
+{
+  return mld_rej_eta_avx2(r, len, buf, buflen, consumed, 4);
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+MLD_EMPTY_CU(avx2_rej_eta)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
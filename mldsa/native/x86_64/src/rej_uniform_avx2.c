@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <immintrin.h>
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+unsigned rej_uniform_avx2(int32_t *r, unsigned len, const uint8_t *buf,
+                          unsigned buflen, unsigned *consumed)
+{
+  unsigned ctr, pos, good;
+  __m256i d, idx;
+  const __m256i bound = _mm256_set1_epi32(MLDSA_Q);
+  const __m256i mask = _mm256_set1_epi32(0x7FFFFF);
+  /* Spread the 3-byte chunks over 32-bit lanes. The upper 128-bit lane
+   * holds bytes 8-23 of the input after the 64-bit permutation. */
+  const __m256i spread = _mm256_set_epi8(
+      -1, 15, 14, 13, -1, 12, 11, 10, -1, 9, 8, 7, -1, 6, 5, 4, /* high */
+      -1, 11, 10, 9, -1, 8, 7, 6, -1, 5, 4, 3, -1, 2, 1, 0 /* low */);
+
+  ctr = pos = 0;
+  /* Each iteration consumes 24 bytes, but loads 32 bytes, and writes
+   * 8 coefficients regardless of how many are accepted. */
+  while (ctr + 8 <= len && pos + 32 <= buflen)
+  {
+    d = _mm256_loadu_si256((const __m256i *)&buf[pos]);
+    d = _mm256_permute4x64_epi64(d, 0x94);
+    d = _mm256_shuffle_epi8(d, spread);
+    d = _mm256_and_si256(d, mask);
+    pos += 24;
+
+    /* Lanes with d < MLDSA_Q have the sign bit set after subtraction */
+    good = (unsigned)_mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_sub_epi32(d, bound)));
+
+    idx = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64((const __m128i *)&rej_uniform_table[good][0]));
+    d = _mm256_permutevar8x32_epi32(d, idx);
+    _mm256_storeu_si256((__m256i *)&r[ctr], d);
+    ctr += mld_popcount8(good);
+  }
+
+  *consumed = pos;
+  return ctr;
+}
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+MLD_EMPTY_CU(avx2_rej_uniform)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
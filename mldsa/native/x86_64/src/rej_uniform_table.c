@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2024-2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * WARNING: This file is auto-generated from scripts/autogen
+ *          Do not modify it directly.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_DEFAULT)
+
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+/*
+ * Lookup table used by rejection sampling of the public matrix.
+ * See autogen for details.
+ */
+MLD_ALIGN const uint8_t rej_uniform_table[256][8] = {
+    {0, 0, 0, 0, 0, 0, 0, 0}, /* 0x0 */
+    {0, 0, 0, 0, 0, 0, 0, 0}, /* 0x1 */
+    {1, 0, 0, 0, 0, 0, 0, 0}, /* 0x2 */
+    {0, 1, 0, 0, 0, 0, 0, 0}, /* 0x3 */
+    {2, 0, 0, 0, 0, 0, 0, 0}, /* 0x4 */
+    {0, 2, 0, 0, 0, 0, 0, 0}, /* 0x5 */
+    {1, 2, 0, 0, 0, 0, 0, 0}, /* 0x6 */
+    {0, 1, 2, 0, 0, 0, 0, 0}, /* 0x7 */
+    {3, 0, 0, 0, 0, 0, 0, 0}, /* 0x8 */
+    {0, 3, 0, 0, 0, 0, 0, 0}, /* 0x9 */
+    {1, 3, 0, 0, 0, 0, 0, 0}, /* 0xa */
+    {0, 1, 3, 0, 0, 0, 0, 0}, /* 0xb */
+    {2, 3, 0, 0, 0, 0, 0, 0}, /* 0xc */
+    {0, 2, 3, 0, 0, 0, 0, 0}, /* 0xd */
+    {1, 2, 3, 0, 0, 0, 0, 0}, /* 0xe */
+    {0, 1, 2, 3, 0, 0, 0, 0}, /* 0xf */
+    {4, 0, 0, 0, 0, 0, 0, 0}, /* 0x10 */
+    {0, 4, 0, 0, 0, 0, 0, 0}, /* 0x11 */
+    {1, 4, 0, 0, 0, 0, 0, 0}, /* 0x12 */
+    {0, 1, 4, 0, 0, 0, 0, 0}, /* 0x13 */
+    {2, 4, 0, 0, 0, 0, 0, 0}, /* 0x14 */
+    {0, 2, 4, 0, 0, 0, 0, 0}, /* 0x15 */
+    {1, 2, 4, 0, 0, 0, 0, 0}, /* 0x16 */
+    {0, 1, 2, 4, 0, 0, 0, 0}, /* 0x17 */
+    {3, 4, 0, 0, 0, 0, 0, 0}, /* 0x18 */
+    {0, 3, 4, 0, 0, 0, 0, 0}, /* 0x19 */
+    {1, 3, 4, 0, 0, 0, 0, 0}, /* 0x1a */
+    {0, 1, 3, 4, 0, 0, 0, 0}, /* 0x1b */
+    {2, 3, 4, 0, 0, 0, 0, 0}, /* 0x1c */
+    {0, 2, 3, 4, 0, 0, 0, 0}, /* 0x1d */
+    {1, 2, 3, 4, 0, 0, 0, 0}, /* 0x1e */
+    {0, 1, 2, 3, 4, 0, 0, 0}, /* 0x1f */
+    {5, 0, 0, 0, 0, 0, 0, 0}, /* 0x20 */
+    {0, 5, 0, 0, 0, 0, 0, 0}, /* 0x21 */
+    {1, 5, 0, 0, 0, 0, 0, 0}, /* 0x22 */
+    {0, 1, 5, 0, 0, 0, 0, 0}, /* 0x23 */
+    {2, 5, 0, 0, 0, 0, 0, 0}, /* 0x24 */
+    {0, 2, 5, 0, 0, 0, 0, 0}, /* 0x25 */
+    {1, 2, 5, 0, 0, 0, 0, 0}, /* 0x26 */
+    {0, 1, 2, 5, 0, 0, 0, 0}, /* 0x27 */
+    {3, 5, 0, 0, 0, 0, 0, 0}, /* 0x28 */
+    {0, 3, 5, 0, 0, 0, 0, 0}, /* 0x29 */
+    {1, 3, 5, 0, 0, 0, 0, 0}, /* 0x2a */
+    {0, 1, 3, 5, 0, 0, 0, 0}, /* 0x2b */
+    {2, 3, 5, 0, 0, 0, 0, 0}, /* 0x2c */
+    {0, 2, 3, 5, 0, 0, 0, 0}, /* 0x2d */
+    {1, 2, 3, 5, 0, 0, 0, 0}, /* 0x2e */
+    {0, 1, 2, 3, 5, 0, 0, 0}, /* 0x2f */
+    {4, 5, 0, 0, 0, 0, 0, 0}, /* 0x30 */
+    {0, 4, 5, 0, 0, 0, 0, 0}, /* 0x31 */
+    {1, 4, 5, 0, 0, 0, 0, 0}, /* 0x32 */
+    {0, 1, 4, 5, 0, 0, 0, 0}, /* 0x33 */
+    {2, 4, 5, 0, 0, 0, 0, 0}, /* 0x34 */
+    {0, 2, 4, 5, 0, 0, 0, 0}, /* 0x35 */
+    {1, 2, 4, 5, 0, 0, 0, 0}, /* 0x36 */
+    {0, 1, 2, 4, 5, 0, 0, 0}, /* 0x37 */
+    {3, 4, 5, 0, 0, 0, 0, 0}, /* 0x38 */
+    {0, 3, 4, 5, 0, 0, 0, 0}, /* 0x39 */
+    {1, 3, 4, 5, 0, 0, 0, 0}, /* 0x3a */
+    {0, 1, 3, 4, 5, 0, 0, 0}, /* 0x3b */
+    {2, 3, 4, 5, 0, 0, 0, 0}, /* 0x3c */
+    {0, 2, 3, 4, 5, 0, 0, 0}, /* 0x3d */
+    {1, 2, 3, 4, 5, 0, 0, 0}, /* 0x3e */
+    {0, 1, 2, 3, 4, 5, 0, 0}, /* 0x3f */
+    {6, 0, 0, 0, 0, 0, 0, 0}, /* 0x40 */
+    {0, 6, 0, 0, 0, 0, 0, 0}, /* 0x41 */
+    {1, 6, 0, 0, 0, 0, 0, 0}, /* 0x42 */
+    {0, 1, 6, 0, 0, 0, 0, 0}, /* 0x43 */
+    {2, 6, 0, 0, 0, 0, 0, 0}, /* 0x44 */
+    {0, 2, 6, 0, 0, 0, 0, 0}, /* 0x45 */
+    {1, 2, 6, 0, 0, 0, 0, 0}, /* 0x46 */
+    {0, 1, 2, 6, 0, 0, 0, 0}, /* 0x47 */
+    {3, 6, 0, 0, 0, 0, 0, 0}, /* 0x48 */
+    {0, 3, 6, 0, 0, 0, 0, 0}, /* 0x49 */
+    {1, 3, 6, 0, 0, 0, 0, 0}, /* 0x4a */
+    {0, 1, 3, 6, 0, 0, 0, 0}, /* 0x4b */
+    {2, 3, 6, 0, 0, 0, 0, 0}, /* 0x4c */
+    {0, 2, 3, 6, 0, 0, 0, 0}, /* 0x4d */
+    {1, 2, 3, 6, 0, 0, 0, 0}, /* 0x4e */
+    {0, 1, 2, 3, 6, 0, 0, 0}, /* 0x4f */
+    {4, 6, 0, 0, 0, 0, 0, 0}, /* 0x50 */
+    {0, 4, 6, 0, 0, 0, 0, 0}, /* 0x51 */
+    {1, 4, 6, 0, 0, 0, 0, 0}, /* 0x52 */
+    {0, 1, 4, 6, 0, 0, 0, 0}, /* 0x53 */
+    {2, 4, 6, 0, 0, 0, 0, 0}, /* 0x54 */
+    {0, 2, 4, 6, 0, 0, 0, 0}, /* 0x55 */
+    {1, 2, 4, 6, 0, 0, 0, 0}, /* 0x56 */
+    {0, 1, 2, 4, 6, 0, 0, 0}, /* 0x57 */
+    {3, 4, 6, 0, 0, 0, 0, 0}, /* 0x58 */
+    {0, 3, 4, 6, 0, 0, 0, 0}, /* 0x59 */
+    {1, 3, 4, 6, 0, 0, 0, 0}, /* 0x5a */
+    {0, 1, 3, 4, 6, 0, 0, 0}, /* 0x5b */
+    {2, 3, 4, 6, 0, 0, 0, 0}, /* 0x5c */
+    {0, 2, 3, 4, 6, 0, 0, 0}, /* 0x5d */
+    {1, 2, 3, 4, 6, 0, 0, 0}, /* 0x5e */
+    {0, 1, 2, 3, 4, 6, 0, 0}, /* 0x5f */
+    {5, 6, 0, 0, 0, 0, 0, 0}, /* 0x60 */
+    {0, 5, 6, 0, 0, 0, 0, 0}, /* 0x61 */
+    {1, 5, 6, 0, 0, 0, 0, 0}, /* 0x62 */
+    {0, 1, 5, 6, 0, 0, 0, 0}, /* 0x63 */
+    {2, 5, 6, 0, 0, 0, 0, 0}, /* 0x64 */
+    {0, 2, 5, 6, 0, 0, 0, 0}, /* 0x65 */
+    {1, 2, 5, 6, 0, 0, 0, 0}, /* 0x66 */
+    {0, 1, 2, 5, 6, 0, 0, 0}, /* 0x67 */
+    {3, 5, 6, 0, 0, 0, 0, 0}, /* 0x68 */
+    {0, 3, 5, 6, 0, 0, 0, 0}, /* 0x69 */
+    {1, 3, 5, 6, 0, 0, 0, 0}, /* 0x6a */
+    {0, 1, 3, 5, 6, 0, 0, 0}, /* 0x6b */
+    {2, 3, 5, 6, 0, 0, 0, 0}, /* 0x6c */
+    {0, 2, 3, 5, 6, 0, 0, 0}, /* 0x6d */
+    {1, 2, 3, 5, 6, 0, 0, 0}, /* 0x6e */
+    {0, 1, 2, 3, 5, 6, 0, 0}, /* 0x6f */
+    {4, 5, 6, 0, 0, 0, 0, 0}, /* 0x70 */
+    {0, 4, 5, 6, 0, 0, 0, 0}, /* 0x71 */
+    {1, 4, 5, 6, 0, 0, 0, 0}, /* 0x72 */
+    {0, 1, 4, 5, 6, 0, 0, 0}, /* 0x73 */
+    {2, 4, 5, 6, 0, 0, 0, 0}, /* 0x74 */
+    {0, 2, 4, 5, 6, 0, 0, 0}, /* 0x75 */
+    {1, 2, 4, 5, 6, 0, 0, 0}, /* 0x76 */
+    {0, 1, 2, 4, 5, 6, 0, 0}, /* 0x77 */
+    {3, 4, 5, 6, 0, 0, 0, 0}, /* 0x78 */
+    {0, 3, 4, 5, 6, 0, 0, 0}, /* 0x79 */
+    {1, 3, 4, 5, 6, 0, 0, 0}, /* 0x7a */
+    {0, 1, 3, 4, 5, 6, 0, 0}, /* 0x7b */
+    {2, 3, 4, 5, 6, 0, 0, 0}, /* 0x7c */
+    {0, 2, 3, 4, 5, 6, 0, 0}, /* 0x7d */
+    {1, 2, 3, 4, 5, 6, 0, 0}, /* 0x7e */
+    {0, 1, 2, 3, 4, 5, 6, 0}, /* 0x7f */
+    {7, 0, 0, 0, 0, 0, 0, 0}, /* 0x80 */
+    {0, 7, 0, 0, 0, 0, 0, 0}, /* 0x81 */
+    {1, 7, 0, 0, 0, 0, 0, 0}, /* 0x82 */
+    {0, 1, 7, 0, 0, 0, 0, 0}, /* 0x83 */
+    {2, 7, 0, 0, 0, 0, 0, 0}, /* 0x84 */
+    {0, 2, 7, 0, 0, 0, 0, 0}, /* 0x85 */
+    {1, 2, 7, 0, 0, 0, 0, 0}, /* 0x86 */
+    {0, 1, 2, 7, 0, 0, 0, 0}, /* 0x87 */
+    {3, 7, 0, 0, 0, 0, 0, 0}, /* 0x88 */
+    {0, 3, 7, 0, 0, 0, 0, 0}, /* 0x89 */
+    {1, 3, 7, 0, 0, 0, 0, 0}, /* 0x8a */
+    {0, 1, 3, 7, 0, 0, 0, 0}, /* 0x8b */
+    {2, 3, 7, 0, 0, 0, 0, 0}, /* 0x8c */
+    {0, 2, 3, 7, 0, 0, 0, 0}, /* 0x8d */
+    {1, 2, 3, 7, 0, 0, 0, 0}, /* 0x8e */
+    {0, 1, 2, 3, 7, 0, 0, 0}, /* 0x8f */
+    {4, 7, 0, 0, 0, 0, 0, 0}, /* 0x90 */
+    {0, 4, 7, 0, 0, 0, 0, 0}, /* 0x91 */
+    {1, 4, 7, 0, 0, 0, 0, 0}, /* 0x92 */
+    {0, 1, 4, 7, 0, 0, 0, 0}, /* 0x93 */
+    {2, 4, 7, 0, 0, 0, 0, 0}, /* 0x94 */
+    {0, 2, 4, 7, 0, 0, 0, 0}, /* 0x95 */
+    {1, 2, 4, 7, 0, 0, 0, 0}, /* 0x96 */
+    {0, 1, 2, 4, 7, 0, 0, 0}, /* 0x97 */
+    {3, 4, 7, 0, 0, 0, 0, 0}, /* 0x98 */
+    {0, 3, 4, 7, 0, 0, 0, 0}, /* 0x99 */
+    {1, 3, 4, 7, 0, 0, 0, 0}, /* 0x9a */
+    {0, 1, 3, 4, 7, 0, 0, 0}, /* 0x9b */
+    {2, 3, 4, 7, 0, 0, 0, 0}, /* 0x9c */
+    {0, 2, 3, 4, 7, 0, 0, 0}, /* 0x9d */
+    {1, 2, 3, 4, 7, 0, 0, 0}, /* 0x9e */
+    {0, 1, 2, 3, 4, 7, 0, 0}, /* 0x9f */
+    {5, 7, 0, 0, 0, 0, 0, 0}, /* 0xa0 */
+    {0, 5, 7, 0, 0, 0, 0, 0}, /* 0xa1 */
+    {1, 5, 7, 0, 0, 0, 0, 0}, /* 0xa2 */
+    {0, 1, 5, 7, 0, 0, 0, 0}, /* 0xa3 */
+    {2, 5, 7, 0, 0, 0, 0, 0}, /* 0xa4 */
+    {0, 2, 5, 7, 0, 0, 0, 0}, /* 0xa5 */
+    {1, 2, 5, 7, 0, 0, 0, 0}, /* 0xa6 */
+    {0, 1, 2, 5, 7, 0, 0, 0}, /* 0xa7 */
+    {3, 5, 7, 0, 0, 0, 0, 0}, /* 0xa8 */
+    {0, 3, 5, 7, 0, 0, 0, 0}, /* 0xa9 */
+    {1, 3, 5, 7, 0, 0, 0, 0}, /* 0xaa */
+    {0, 1, 3, 5, 7, 0, 0, 0}, /* 0xab */
+    {2, 3, 5, 7, 0, 0, 0, 0}, /* 0xac */
+    {0, 2, 3, 5, 7, 0, 0, 0}, /* 0xad */
+    {1, 2, 3, 5, 7, 0, 0, 0}, /* 0xae */
+    {0, 1, 2, 3, 5, 7, 0, 0}, /* 0xaf */
+    {4, 5, 7, 0, 0, 0, 0, 0}, /* 0xb0 */
+    {0, 4, 5, 7, 0, 0, 0, 0}, /* 0xb1 */
+    {1, 4, 5, 7, 0, 0, 0, 0}, /* 0xb2 */
+    {0, 1, 4, 5, 7, 0, 0, 0}, /* 0xb3 */
+    {2, 4, 5, 7, 0, 0, 0, 0}, /* 0xb4 */
+    {0, 2, 4, 5, 7, 0, 0, 0}, /* 0xb5 */
+    {1, 2, 4, 5, 7, 0, 0, 0}, /* 0xb6 */
+    {0, 1, 2, 4, 5, 7, 0, 0}, /* 0xb7 */
+    {3, 4, 5, 7, 0, 0, 0, 0}, /* 0xb8 */
+    {0, 3, 4, 5, 7, 0, 0, 0}, /* 0xb9 */
+    {1, 3, 4, 5, 7, 0, 0, 0}, /* 0xba */
+    {0, 1, 3, 4, 5, 7, 0, 0}, /* 0xbb */
+    {2, 3, 4, 5, 7, 0, 0, 0}, /* 0xbc */
+    {0, 2, 3, 4, 5, 7, 0, 0}, /* 0xbd */
+    {1, 2, 3, 4, 5, 7, 0, 0}, /* 0xbe */
+    {0, 1, 2, 3, 4, 5, 7, 0}, /* 0xbf */
+    {6, 7, 0, 0, 0, 0, 0, 0}, /* 0xc0 */
+    {0, 6, 7, 0, 0, 0, 0, 0}, /* 0xc1 */
+    {1, 6, 7, 0, 0, 0, 0, 0}, /* 0xc2 */
+    {0, 1, 6, 7, 0, 0, 0, 0}, /* 0xc3 */
+    {2, 6, 7, 0, 0, 0, 0, 0}, /* 0xc4 */
+    {0, 2, 6, 7, 0, 0, 0, 0}, /* 0xc5 */
+    {1, 2, 6, 7, 0, 0, 0, 0}, /* 0xc6 */
+    {0, 1, 2, 6, 7, 0, 0, 0}, /* 0xc7 */
+    {3, 6, 7, 0, 0, 0, 0, 0}, /* 0xc8 */
+    {0, 3, 6, 7, 0, 0, 0, 0}, /* 0xc9 */
+    {1, 3, 6, 7, 0, 0, 0, 0}, /* 0xca */
+    {0, 1, 3, 6, 7, 0, 0, 0}, /* 0xcb */
+    {2, 3, 6, 7, 0, 0, 0, 0}, /* 0xcc */
+    {0, 2, 3, 6, 7, 0, 0, 0}, /* 0xcd */
+    {1, 2, 3, 6, 7, 0, 0, 0}, /* 0xce */
+    {0, 1, 2, 3, 6, 7, 0, 0}, /* 0xcf */
+    {4, 6, 7, 0, 0, 0, 0, 0}, /* 0xd0 */
+    {0, 4, 6, 7, 0, 0, 0, 0}, /* 0xd1 */
+    {1, 4, 6, 7, 0, 0, 0, 0}, /* 0xd2 */
+    {0, 1, 4, 6, 7, 0, 0, 0}, /* 0xd3 */
+    {2, 4, 6, 7, 0, 0, 0, 0}, /* 0xd4 */
+    {0, 2, 4, 6, 7, 0, 0, 0}, /* 0xd5 */
+    {1, 2, 4, 6, 7, 0, 0, 0}, /* 0xd6 */
+    {0, 1, 2, 4, 6, 7, 0, 0}, /* 0xd7 */
+    {3, 4, 6, 7, 0, 0, 0, 0}, /* 0xd8 */
+    {0, 3, 4, 6, 7, 0, 0, 0}, /* 0xd9 */
+    {1, 3, 4, 6, 7, 0, 0, 0}, /* 0xda */
+    {0, 1, 3, 4, 6, 7, 0, 0}, /* 0xdb */
+    {2, 3, 4, 6, 7, 0, 0, 0}, /* 0xdc */
+    {0, 2, 3, 4, 6, 7, 0, 0}, /* 0xdd */
+    {1, 2, 3, 4, 6, 7, 0, 0}, /* 0xde */
+    {0, 1, 2, 3, 4, 6, 7, 0}, /* 0xdf */
+    {5, 6, 7, 0, 0, 0, 0, 0}, /* 0xe0 */
+    {0, 5, 6, 7, 0, 0, 0, 0}, /* 0xe1 */
+    {1, 5, 6, 7, 0, 0, 0, 0}, /* 0xe2 */
+    {0, 1, 5, 6, 7, 0, 0, 0}, /* 0xe3 */
+    {2, 5, 6, 7, 0, 0, 0, 0}, /* 0xe4 */
+    {0, 2, 5, 6, 7, 0, 0, 0}, /* 0xe5 */
+    {1, 2, 5, 6, 7, 0, 0, 0}, /* 0xe6 */
+    {0, 1, 2, 5, 6, 7, 0, 0}, /* 0xe7 */
+    {3, 5, 6, 7, 0, 0, 0, 0}, /* 0xe8 */
+    {0, 3, 5, 6, 7, 0, 0, 0}, /* 0xe9 */
+    {1, 3, 5, 6, 7, 0, 0, 0}, /* 0xea */
+    {0, 1, 3, 5, 6, 7, 0, 0}, /* 0xeb */
+    {2, 3, 5, 6, 7, 0, 0, 0}, /* 0xec */
+    {0, 2, 3, 5, 6, 7, 0, 0}, /* 0xed */
+    {1, 2, 3, 5, 6, 7, 0, 0}, /* 0xee */
+    {0, 1, 2, 3, 5, 6, 7, 0}, /* 0xef */
+    {4, 5, 6, 7, 0, 0, 0, 0}, /* 0xf0 */
+    {0, 4, 5, 6, 7, 0, 0, 0}, /* 0xf1 */
+    {1, 4, 5, 6, 7, 0, 0, 0}, /* 0xf2 */
+    {0, 1, 4, 5, 6, 7, 0, 0}, /* 0xf3 */
+    {2, 4, 5, 6, 7, 0, 0, 0}, /* 0xf4 */
+    {0, 2, 4, 5, 6, 7, 0, 0}, /* 0xf5 */
+    {1, 2, 4, 5, 6, 7, 0, 0}, /* 0xf6 */
+    {0, 1, 2, 4, 5, 6, 7, 0}, /* 0xf7 */
+    {3, 4, 5, 6, 7, 0, 0, 0}, /* 0xf8 */
+    {0, 3, 4, 5, 6, 7, 0, 0}, /* 0xf9 */
+    {1, 3, 4, 5, 6, 7, 0, 0}, /* 0xfa */
+    {0, 1, 3, 4, 5, 6, 7, 0}, /* 0xfb */
+    {2, 3, 4, 5, 6, 7, 0, 0}, /* 0xfc */
+    {0, 2, 3, 4, 5, 6, 7, 0}, /* 0xfd */
+    {1, 2, 3, 4, 5, 6, 7, 0}, /* 0xfe */
+    {0, 1, 2, 3, 4, 5, 6, 7}, /* 0xff */
+};
+
+#else /* MLD_ARITH_BACKEND_X86_64_DEFAULT */
+
+MLD_EMPTY_CU(avx2_rej_uniform_table)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_DEFAULT */
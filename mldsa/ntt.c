@@ -7,6 +7,7 @@
 #include "ntt.h"
 #include "reduce.h"
 
+#if !defined(MLD_USE_NATIVE_NTT) || !defined(MLD_USE_NATIVE_INTT)
 static int32_t mld_fqmul(int32_t a, int32_t b)
 __contract__(
   requires(b > -MLDSA_Q_HALF && b < MLDSA_Q_HALF)
@@ -18,7 +19,9 @@ __contract__(
 }
 
 #include "zetas.inc"
+#endif /* !MLD_USE_NATIVE_NTT || !MLD_USE_NATIVE_INTT */
 
+#if !defined(MLD_USE_NATIVE_NTT)
 
 /* mld_ntt_butterfly_block()
  *
@@ -140,7 +143,11 @@ void ntt(int32_t a[MLDSA_N])
   /* directly implies the postcondition in that coefficients */
   /* are bounded in magnitude by 9 * MLDSA_Q                 */
 }
+#else /* !MLD_USE_NATIVE_NTT */
+void ntt(int32_t a[MLDSA_N]) { ntt_native(a); }
+#endif /* MLD_USE_NATIVE_NTT */
 
+#if !defined(MLD_USE_NATIVE_INTT)
 /* Reference: Embedded into `invntt_tomont()` in the reference implementation
  * [@REF] */
 static void mld_invntt_layer(int32_t r[MLDSA_N], unsigned layer)
@@ -217,3 +224,6 @@ void invntt_tomont(int32_t a[MLDSA_N])
     a[j] = mld_fqmul(a[j], f);
   }
 }
+#else /* !MLD_USE_NATIVE_INTT */
+void invntt_tomont(int32_t a[MLDSA_N]) { intt_native(a); }
+#endif /* MLD_USE_NATIVE_INTT */
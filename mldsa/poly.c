@@ -88,6 +88,7 @@ void poly_ntt(poly *a) { ntt(a->coeffs); }
 
 void poly_invntt_tomont(poly *a) { invntt_tomont(a->coeffs); }
 
+#if !defined(MLD_USE_NATIVE_POINTWISE_MONTGOMERY)
 void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b)
 {
   unsigned int i;
@@ -99,6 +100,12 @@ void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b)
     c->coeffs[i] = montgomery_reduce((int64_t)a->coeffs[i] * b->coeffs[i]);
   }
 }
+#else  /* !MLD_USE_NATIVE_POINTWISE_MONTGOMERY */
+void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b)
+{
+  poly_pointwise_montgomery_native(c->coeffs, a->coeffs, b->coeffs);
+}
+#endif /* MLD_USE_NATIVE_POINTWISE_MONTGOMERY */
 
 void poly_power2round(poly *a1, poly *a0, const poly *a)
 {
@@ -230,6 +237,11 @@ __contract__(
   uint32_t t;
 
   ctr = pos = 0;
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+  /* The native implementation leaves the tail to the loop below */
+  ctr = rej_uniform_native(a, len, buf, buflen, &pos);
+#endif
+
   /* pos + 3 cannot overflow due to the assumption
   buflen <= (POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES) */
   while (ctr < len && pos + 3 <= buflen)
@@ -278,6 +290,64 @@ void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce)
   }
 }
 
+void poly_uniform_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                     const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce0,
+                     uint16_t nonce1, uint16_t nonce2, uint16_t nonce3)
+{
+  unsigned int i, j, buflen;
+  unsigned int ctr[4];
+  poly *a[4];
+  uint16_t nonce[4];
+  MLD_ALIGN uint8_t extseed[4][MLD_ALIGN_UP(MLDSA_SEEDBYTES + 2)];
+  MLD_ALIGN uint8_t
+      buf[4][MLD_ALIGN_UP(POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES)];
+  keccakx4_state state;
+
+  a[0] = a0;
+  a[1] = a1;
+  a[2] = a2;
+  a[3] = a3;
+  nonce[0] = nonce0;
+  nonce[1] = nonce1;
+  nonce[2] = nonce2;
+  nonce[3] = nonce3;
+
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < MLDSA_SEEDBYTES; i++)
+    {
+      extseed[j][i] = seed[i];
+    }
+    extseed[j][MLDSA_SEEDBYTES + 0] = (uint8_t)nonce[j];
+    extseed[j][MLDSA_SEEDBYTES + 1] = (uint8_t)(nonce[j] >> 8);
+  }
+
+  shake128x4_absorb_once(&state, extseed[0], extseed[1], extseed[2],
+                         extseed[3], MLDSA_SEEDBYTES + 2);
+  shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           POLY_UNIFORM_NBLOCKS, &state);
+
+  buflen = POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES;
+  for (j = 0; j < 4; j++)
+  {
+    ctr[j] = rej_uniform(a[j]->coeffs, MLDSA_N, buf[j], buflen);
+  }
+
+  /* STREAM128_BLOCKBYTES is a multiple of 3, so unlike in poly_uniform(),
+   * no bytes need to be carried over between blocks. */
+  buflen = STREAM128_BLOCKBYTES;
+  while (ctr[0] < MLDSA_N || ctr[1] < MLDSA_N || ctr[2] < MLDSA_N ||
+         ctr[3] < MLDSA_N)
+  {
+    shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+    for (j = 0; j < 4; j++)
+    {
+      ctr[j] += rej_uniform(a[j]->coeffs + ctr[j], MLDSA_N - ctr[j], buf[j],
+                            buflen);
+    }
+  }
+}
+
 /*************************************************
  * Name:        rej_eta
  *
@@ -317,6 +387,13 @@ __contract__(
   uint32_t t0, t1;
 
   ctr = pos = 0;
+  /* The native implementation leaves the tail to the loop below */
+#if MLDSA_ETA == 2 && defined(MLD_USE_NATIVE_REJ_ETA2)
+  ctr = rej_eta2_native(a, len, buf, buflen, &pos);
+#elif MLDSA_ETA == 4 && defined(MLD_USE_NATIVE_REJ_ETA4)
+  ctr = rej_eta4_native(a, len, buf, buflen, &pos);
+#endif
+
   while (ctr < len && pos < buflen)
   __loop__(
     invariant(0 <= ctr && ctr <= len && pos <= buflen)
@@ -375,6 +452,64 @@ void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
   }
 }
 
+void poly_uniform_eta_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                         const uint8_t seed[MLDSA_CRHBYTES], uint16_t nonce0,
+                         uint16_t nonce1, uint16_t nonce2, uint16_t nonce3)
+{
+  unsigned int i, j, buflen;
+  unsigned int ctr[4];
+  poly *a[4];
+  uint16_t nonce[4];
+  MLD_ALIGN uint8_t extseed[4][MLD_ALIGN_UP(MLDSA_CRHBYTES + 2)];
+  MLD_ALIGN uint8_t
+      buf[4][MLD_ALIGN_UP(POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES)];
+  keccakx4_state state;
+
+  a[0] = a0;
+  a[1] = a1;
+  a[2] = a2;
+  a[3] = a3;
+  nonce[0] = nonce0;
+  nonce[1] = nonce1;
+  nonce[2] = nonce2;
+  nonce[3] = nonce3;
+
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < MLDSA_CRHBYTES; i++)
+    {
+      extseed[j][i] = seed[i];
+    }
+    extseed[j][MLDSA_CRHBYTES + 0] = (uint8_t)nonce[j];
+    extseed[j][MLDSA_CRHBYTES + 1] = (uint8_t)(nonce[j] >> 8);
+  }
+
+  shake256x4_absorb_once(&state, extseed[0], extseed[1], extseed[2],
+                         extseed[3], MLDSA_CRHBYTES + 2);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           POLY_UNIFORM_ETA_NBLOCKS, &state);
+
+  buflen = POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES;
+  for (j = 0; j < 4; j++)
+  {
+    ctr[j] = rej_eta(a[j]->coeffs, MLDSA_N, buf[j], buflen);
+  }
+
+  /* Further blocks are squeezed for all four streams, but only the
+   * polynomials that still need coefficients consume them. */
+  buflen = STREAM256_BLOCKBYTES;
+  while (ctr[0] < MLDSA_N || ctr[1] < MLDSA_N || ctr[2] < MLDSA_N ||
+         ctr[3] < MLDSA_N)
+  {
+    shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+    for (j = 0; j < 4; j++)
+    {
+      ctr[j] += rej_eta(a[j]->coeffs + ctr[j], MLDSA_N - ctr[j], buf[j],
+                        buflen);
+    }
+  }
+}
+
 #define POLY_UNIFORM_GAMMA1_NBLOCKS \
   ((MLDSA_POLYZ_PACKEDBYTES + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
 void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
@@ -388,6 +523,58 @@ void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
   polyz_unpack(a, buf);
 }
 
+void poly_uniform_gamma1_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                            const uint8_t seed0[MLDSA_CRHBYTES],
+                            const uint8_t seed1[MLDSA_CRHBYTES],
+                            const uint8_t seed2[MLDSA_CRHBYTES],
+                            const uint8_t seed3[MLDSA_CRHBYTES],
+                            uint16_t nonce0, uint16_t nonce1, uint16_t nonce2,
+                            uint16_t nonce3)
+{
+  unsigned int i, j;
+  poly *a[4];
+  const uint8_t *seed[4];
+  uint16_t nonce[4];
+  MLD_ALIGN uint8_t extseed[4][MLD_ALIGN_UP(MLDSA_CRHBYTES + 2)];
+  MLD_ALIGN uint8_t
+      buf[4][MLD_ALIGN_UP(POLY_UNIFORM_GAMMA1_NBLOCKS * STREAM256_BLOCKBYTES)];
+  keccakx4_state state;
+
+  a[0] = a0;
+  a[1] = a1;
+  a[2] = a2;
+  a[3] = a3;
+  seed[0] = seed0;
+  seed[1] = seed1;
+  seed[2] = seed2;
+  seed[3] = seed3;
+  nonce[0] = nonce0;
+  nonce[1] = nonce1;
+  nonce[2] = nonce2;
+  nonce[3] = nonce3;
+
+  for (j = 0; j < 4; j++)
+  {
+    for (i = 0; i < MLDSA_CRHBYTES; i++)
+    {
+      extseed[j][i] = seed[j][i];
+    }
+    extseed[j][MLDSA_CRHBYTES + 0] = (uint8_t)nonce[j];
+    extseed[j][MLDSA_CRHBYTES + 1] = (uint8_t)(nonce[j] >> 8);
+  }
+
+  shake256x4_absorb_once(&state, extseed[0], extseed[1], extseed[2],
+                         extseed[3], MLDSA_CRHBYTES + 2);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
+
+  /* No rejection is needed, so the squeezed blocks are unpacked in place */
+  for (j = 0; j < 4; j++)
+  {
+    polyz_unpack(a[j], buf[j]);
+  }
+}
+
 void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
 {
   unsigned int i, b, pos;
@@ -430,6 +617,128 @@ void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
   }
 }
 
+void poly_challenge_4x(poly *c0, poly *c1, poly *c2, poly *c3,
+                       const uint8_t seed0[MLDSA_CTILDEBYTES],
+                       const uint8_t seed1[MLDSA_CTILDEBYTES],
+                       const uint8_t seed2[MLDSA_CTILDEBYTES],
+                       const uint8_t seed3[MLDSA_CTILDEBYTES])
+{
+  unsigned int i[4], j, b, pos, done;
+  uint64_t signs[4];
+  poly *c[4];
+  MLD_ALIGN uint8_t buf[4][MLD_ALIGN_UP(SHAKE256_RATE)];
+  keccakx4_state state;
+
+  c[0] = c0;
+  c[1] = c1;
+  c[2] = c2;
+  c[3] = c3;
+
+  shake256x4_absorb_once(&state, seed0, seed1, seed2, seed3,
+                         MLDSA_CTILDEBYTES);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+
+  for (j = 0; j < 4; j++)
+  {
+    signs[j] = 0;
+    for (pos = 0; pos < 8; ++pos)
+    {
+      signs[j] |= (uint64_t)buf[j][pos] << 8 * pos;
+    }
+    for (pos = 0; pos < MLDSA_N; ++pos)
+    {
+      c[j]->coeffs[pos] = 0;
+    }
+    i[j] = MLDSA_N - MLDSA_TAU;
+  }
+
+  /* Run the sampling loop of poly_challenge() on every lane until it runs
+   * out of bytes, and squeeze the next block of all four streams while
+   * any lane is unfinished. Every lane consumes its own stream in order,
+   * so the result is the same as for poly_challenge(). */
+  pos = 8;
+  for (;;)
+  {
+    done = 0;
+    for (j = 0; j < 4; j++)
+    {
+      unsigned int p = pos;
+      while (i[j] < MLDSA_N && p < SHAKE256_RATE)
+      {
+        b = buf[j][p++];
+        if (b > i[j])
+        {
+          continue;
+        }
+        c[j]->coeffs[i[j]] = c[j]->coeffs[b];
+        c[j]->coeffs[b] = 1 - 2 * (signs[j] & 1);
+        signs[j] >>= 1;
+        i[j]++;
+      }
+      done += (i[j] == MLDSA_N);
+    }
+
+    if (done == 4)
+    {
+      break;
+    }
+    shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+    pos = 0;
+  }
+}
+
+void poly_sparse_from_challenge(poly_sparse *s, const poly *c)
+{
+  unsigned int i, j;
+
+  j = 0;
+  for (i = 0; i < MLDSA_N; ++i)
+  {
+    if (c->coeffs[i] != 0)
+    {
+      s->pos[j] = (uint8_t)i;
+      s->sign[j] = c->coeffs[i];
+      j++;
+    }
+  }
+}
+
+void poly_sparse_mul(poly *r, const poly_sparse *c, const poly *a)
+{
+  unsigned int i, j;
+  int32_t *t;
+  int32_t acc[2 * MLDSA_N];
+
+  /* Accumulate the rotations X^pos * a in a product of length 2N, with
+   * fixed-length loops, and fold it with X^N = -1 afterwards */
+  for (i = 0; i < 2 * MLDSA_N; ++i)
+  {
+    acc[i] = 0;
+  }
+  for (j = 0; j < MLDSA_TAU; ++j)
+  {
+    t = acc + c->pos[j];
+    if (c->sign[j] > 0)
+    {
+      for (i = 0; i < MLDSA_N; ++i)
+      {
+        t[i] += a->coeffs[i];
+      }
+    }
+    else
+    {
+      for (i = 0; i < MLDSA_N; ++i)
+      {
+        t[i] -= a->coeffs[i];
+      }
+    }
+  }
+  for (i = 0; i < MLDSA_N; ++i)
+  {
+    r->coeffs[i] = acc[i] - acc[i + MLDSA_N];
+  }
+}
+
 void polyeta_pack(uint8_t *r, const poly *a)
 {
   unsigned int i;
@@ -17,6 +17,14 @@ typedef struct
   int32_t coeffs[MLDSA_N];
 } poly;
 
+/* Polynomial with MLDSA_TAU nonzero coefficients in {-1,1}, such as a
+ * challenge: the sum of sign[j] * X^pos[j] */
+typedef struct
+{
+  uint8_t pos[MLDSA_TAU];
+  int32_t sign[MLDSA_TAU];
+} poly_sparse;
+
 #define poly_reduce MLD_NAMESPACE(poly_reduce)
 /*************************************************
  * Name:        poly_reduce
@@ -299,6 +307,26 @@ __contract__(
  **************************************************/
 void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce);
 
+#define poly_uniform_4x MLD_NAMESPACE(poly_uniform_4x)
+/*************************************************
+ * Name:        poly_uniform_4x
+ *
+ * Description: Sample four polynomials with uniformly random coefficients
+ *              in [0,MLDSA_Q-1] by performing rejection sampling on the
+ *              output streams of SHAKE128(seed|nonce_i), computed in
+ *              parallel using 4-way batched Keccak.
+ *
+ *              The result is the same as for four calls to poly_uniform().
+ *
+ * Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_SEEDBYTES
+ *              - uint16_t nonce0, ..., nonce3: 2-byte nonces
+ **************************************************/
+void poly_uniform_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                     const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce0,
+                     uint16_t nonce1, uint16_t nonce2, uint16_t nonce3);
+
 #define poly_uniform_eta MLD_NAMESPACE(poly_uniform_eta)
 /*************************************************
  * Name:        poly_uniform_eta
@@ -315,6 +343,27 @@ void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce);
 void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
                       uint16_t nonce);
 
+#define poly_uniform_eta_4x MLD_NAMESPACE(poly_uniform_eta_4x)
+/*************************************************
+ * Name:        poly_uniform_eta_4x
+ *
+ * Description: Sample four polynomials with uniformly random coefficients
+ *              in [-MLDSA_ETA,MLDSA_ETA] by performing rejection sampling
+ *              on the output streams of SHAKE256(seed|nonce_i), computed
+ *              in parallel using 4-way batched Keccak.
+ *
+ *              The result is the same as for four calls to
+ *              poly_uniform_eta().
+ *
+ * Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_CRHBYTES
+ *              - uint16_t nonce0, ..., nonce3: 2-byte nonces
+ **************************************************/
+void poly_uniform_eta_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                         const uint8_t seed[MLDSA_CRHBYTES], uint16_t nonce0,
+                         uint16_t nonce1, uint16_t nonce2, uint16_t nonce3);
+
 #define poly_uniform_gamma1 MLD_NAMESPACE(poly_uniform_gamma1)
 /*************************************************
  * Name:        poly_uniform_gamma1m1
@@ -331,6 +380,31 @@ void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
 void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
                          uint16_t nonce);
 
+#define poly_uniform_gamma1_4x MLD_NAMESPACE(poly_uniform_gamma1_4x)
+/*************************************************
+ * Name:        poly_uniform_gamma1_4x
+ *
+ * Description: Sample four polynomials with uniformly random coefficients
+ *              in [-(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1] by unpacking the
+ *              output streams of SHAKE256(seed_i|nonce_i), computed in
+ *              parallel using 4-way batched Keccak.
+ *
+ *              The result is the same as for four calls to
+ *              poly_uniform_gamma1().
+ *
+ * Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+ *              - const uint8_t seed0[], ..., seed3[]: byte arrays with
+ *                seeds of length MLDSA_CRHBYTES
+ *              - uint16_t nonce0, ..., nonce3: 16-bit nonces
+ **************************************************/
+void poly_uniform_gamma1_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                            const uint8_t seed0[MLDSA_CRHBYTES],
+                            const uint8_t seed1[MLDSA_CRHBYTES],
+                            const uint8_t seed2[MLDSA_CRHBYTES],
+                            const uint8_t seed3[MLDSA_CRHBYTES],
+                            uint16_t nonce0, uint16_t nonce1, uint16_t nonce2,
+                            uint16_t nonce3);
+
 #define poly_challenge MLD_NAMESPACE(poly_challenge)
 /*************************************************
  * Name:        poly_challenge
@@ -345,6 +419,59 @@ void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
  **************************************************/
 void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES]);
 
+#define poly_challenge_4x MLD_NAMESPACE(poly_challenge_4x)
+/*************************************************
+ * Name:        poly_challenge_4x
+ *
+ * Description: Four calls of poly_challenge() with independent seeds,
+ *              using 4-way batched Keccak. The output is the same as for
+ *              four separate calls.
+ *
+ * Arguments:   - poly *c0, ..., *c3: pointers to output polynomials
+ *              - const uint8_t seed0[], ..., seed3[]: byte arrays
+ *                containing the seeds of length MLDSA_CTILDEBYTES
+ **************************************************/
+void poly_challenge_4x(poly *c0, poly *c1, poly *c2, poly *c3,
+                       const uint8_t seed0[MLDSA_CTILDEBYTES],
+                       const uint8_t seed1[MLDSA_CTILDEBYTES],
+                       const uint8_t seed2[MLDSA_CTILDEBYTES],
+                       const uint8_t seed3[MLDSA_CTILDEBYTES]);
+
+#define poly_sparse_from_challenge MLD_NAMESPACE(poly_sparse_from_challenge)
+/*************************************************
+ * Name:        poly_sparse_from_challenge
+ *
+ * Description: Lists the MLDSA_TAU nonzero coefficients of a challenge
+ *              polynomial as returned by poly_challenge(), in increasing
+ *              order of their index.
+ *
+ *              Like poly_challenge(), this branches on the positions of
+ *              the nonzero coefficients, which are not secret.
+ *
+ * Arguments:   - poly_sparse *s: pointer to output sparse polynomial
+ *              - const poly *c: pointer to input challenge polynomial
+ **************************************************/
+void poly_sparse_from_challenge(poly_sparse *s, const poly *c);
+
+#define poly_sparse_mul MLD_NAMESPACE(poly_sparse_mul)
+/*************************************************
+ * Name:        poly_sparse_mul
+ *
+ * Description: Multiplication of a polynomial by a sparse polynomial in
+ *              the normal domain, as a sum of MLDSA_TAU signed negacyclic
+ *              rotations of a. No modular reduction is performed.
+ *
+ *              The memory access pattern depends on the positions in c
+ *              only, and not on a.
+ *
+ * Arguments:   - poly *r: pointer to output polynomial, coefficients
+ *                         bounded by MLDSA_TAU times the bound on a
+ *              - const poly_sparse *c: pointer to sparse polynomial
+ *              - const poly *a: pointer to input polynomial, coefficients
+ *                               bounded by 2^31 / MLDSA_TAU
+ **************************************************/
+void poly_sparse_mul(poly *r, const poly_sparse *c, const poly *a);
+
 #define polyeta_pack MLD_NAMESPACE(polyeta_pack)
 /*************************************************
  * Name:        polyeta_pack
@@ -3,60 +3,179 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <stdint.h>
+#include <string.h>
 
 #include "common.h"
 #include "poly.h"
 #include "polyvec.h"
 
-void polyvec_matrix_expand(polyvecl mat[MLDSA_K],
-                           const uint8_t rho[MLDSA_SEEDBYTES])
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+void polyvec_matrix_expand(polymat *mat, const uint8_t rho[MLDSA_SEEDBYTES])
 {
   unsigned int i, j;
+  poly *a[4];
+  uint16_t nonce[4];
+
+  /* Sample four entries at a time, in row-major order. The nonces are
+   * independent of the order of generation, so the result is the same
+   * as when generating one entry at a time. */
+  j = 0;
+  for (i = 0; i < MLDSA_K * MLDSA_L; ++i)
+  {
+    a[j] = &mat->vec[i / MLDSA_L].vec[i % MLDSA_L];
+    nonce[j] = (uint16_t)(((i / MLDSA_L) << 8) + (i % MLDSA_L));
+    if (++j == 4)
+    {
+      poly_uniform_4x(a[0], a[1], a[2], a[3], rho, nonce[0], nonce[1],
+                      nonce[2], nonce[3]);
+      j = 0;
+    }
+  }
 
-  for (i = 0; i < MLDSA_K; ++i)
+  /* Remaining entries, if MLDSA_K * MLDSA_L is not a multiple of 4 */
+  for (i = 0; i < j; ++i)
   {
-    for (j = 0; j < MLDSA_L; ++j)
+    poly_uniform(a[i], rho, nonce[i]);
+  }
+}
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+void polyvec_matrix_expand(polymat *mat, const uint8_t rho[MLDSA_SEEDBYTES])
+{
+  memcpy(mat->rho, rho, MLDSA_SEEDBYTES);
+}
+#endif /* MLD_CONFIG_REDUCE_RAM */
+
+void polyvec_uniform_eta(polyvecl *s1, polyveck *s2,
+                         const uint8_t seed[MLDSA_CRHBYTES])
+{
+  unsigned int i, j;
+  poly *a[4];
+  poly tmp[2];
+
+  /* Sample s1 and s2 four polynomials at a time, using nonces
+   * 0, ..., MLDSA_L + MLDSA_K - 1 as for sampling them one by one. */
+  j = 0;
+  for (i = 0; i < MLDSA_L + MLDSA_K; ++i)
+  {
+    a[j] = i < MLDSA_L ? &s1->vec[i] : &s2->vec[i - MLDSA_L];
+    if (++j == 4)
+    {
+      poly_uniform_eta_4x(a[0], a[1], a[2], a[3], seed, (uint16_t)(i - 3),
+                          (uint16_t)(i - 2), (uint16_t)(i - 1), (uint16_t)i);
+      j = 0;
+    }
+  }
+
+  /* Remaining polynomials, if MLDSA_L + MLDSA_K is not a multiple of 4.
+   * A single one is sampled on its own; otherwise the batch is padded
+   * with scratch polynomials. */
+  if (j == 1)
+  {
+    poly_uniform_eta(a[0], seed, (uint16_t)(MLDSA_L + MLDSA_K - 1));
+  }
+  else if (j > 1)
+  {
+    for (i = j; i < 4; ++i)
     {
-      poly_uniform(&mat[i].vec[j], rho, (i << 8) + j);
+      a[i] = &tmp[i - 2];
     }
+    poly_uniform_eta_4x(a[0], a[1], a[2], a[3], seed,
+                        (uint16_t)(MLDSA_L + MLDSA_K - j),
+                        (uint16_t)(MLDSA_L + MLDSA_K - j + 1),
+                        (uint16_t)(MLDSA_L + MLDSA_K - j + 2),
+                        (uint16_t)(MLDSA_L + MLDSA_K - j + 3));
   }
 }
 
-void polyvec_matrix_pointwise_montgomery(polyveck *t,
-                                         const polyvecl mat[MLDSA_K],
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+void polyvec_matrix_pointwise_montgomery(polyveck *t, const polymat *mat,
                                          const polyvecl *v)
 {
   unsigned int i;
 
   for (i = 0; i < MLDSA_K; ++i)
   {
-    polyvecl_pointwise_acc_montgomery(&t->vec[i], &mat[i], v);
+    polyvecl_pointwise_acc_montgomery(&t->vec[i], &mat->vec[i], v);
   }
 }
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+void polyvec_matrix_pointwise_montgomery(polyveck *t, const polymat *mat,
+                                         const polyvecl *v)
+{
+  unsigned int i, j;
+  poly a, tmp;
+
+  /* Sample a_{i,j} with the same nonce as polyvec_matrix_expand(), and
+   * accumulate a_{i,j} * v_j right away. Each product is bound by MLDSA_Q,
+   * so the sum is bound by MLDSA_L * MLDSA_Q as for the expanded matrix. */
+  for (i = 0; i < MLDSA_K; ++i)
+  {
+    for (j = 0; j < MLDSA_L; ++j)
+    {
+      poly_uniform(&a, mat->rho, (uint16_t)((i << 8) + j));
+      if (j == 0)
+      {
+        poly_pointwise_montgomery(&t->vec[i], &a, &v->vec[0]);
+      }
+      else
+      {
+        poly_pointwise_montgomery(&tmp, &a, &v->vec[j]);
+        poly_add(&t->vec[i], &t->vec[i], &tmp);
+      }
+    }
+  }
+}
+#endif /* MLD_CONFIG_REDUCE_RAM */
 
 /**************************************************************/
 /************ Vectors of polynomials of length MLDSA_L **************/
 /**************************************************************/
 
-void polyvecl_uniform_eta(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
-                          uint16_t nonce)
+void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
+                             uint16_t nonce)
 {
-  unsigned int i;
+  nonce = (uint16_t)(MLDSA_L * nonce);
 
-  for (i = 0; i < MLDSA_L; ++i)
+  /* Sample four polynomials at a time. For MLDSA_L == 7, the last
+   * batch is padded with a scratch polynomial, which is cheaper than
+   * sampling the remaining three one at a time. */
+  poly_uniform_gamma1_4x(&v->vec[0], &v->vec[1], &v->vec[2], &v->vec[3], seed,
+                         seed, seed, seed, nonce, nonce + 1, nonce + 2,
+                         nonce + 3);
+#if MLDSA_L == 5
+  poly_uniform_gamma1(&v->vec[4], seed, nonce + 4);
+#elif MLDSA_L == 7
   {
-    poly_uniform_eta(&v->vec[i], seed, nonce++);
+    poly tmp;
+    poly_uniform_gamma1_4x(&v->vec[4], &v->vec[5], &v->vec[6], &tmp, seed,
+                           seed, seed, seed, nonce + 4, nonce + 5, nonce + 6,
+                           nonce + 7);
   }
+#endif /* MLDSA_L == 7 */
 }
 
-void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
-                             uint16_t nonce)
+void polyvecl_uniform_gamma1_4x(polyvecl *v0, polyvecl *v1, polyvecl *v2,
+                                polyvecl *v3,
+                                const uint8_t seed0[MLDSA_CRHBYTES],
+                                const uint8_t seed1[MLDSA_CRHBYTES],
+                                const uint8_t seed2[MLDSA_CRHBYTES],
+                                const uint8_t seed3[MLDSA_CRHBYTES],
+                                uint16_t nonce0, uint16_t nonce1,
+                                uint16_t nonce2, uint16_t nonce3)
 {
   unsigned int i;
 
+  nonce0 = (uint16_t)(MLDSA_L * nonce0);
+  nonce1 = (uint16_t)(MLDSA_L * nonce1);
+  nonce2 = (uint16_t)(MLDSA_L * nonce2);
+  nonce3 = (uint16_t)(MLDSA_L * nonce3);
+
+  /* One polynomial of each vector at a time, so no lane is wasted */
   for (i = 0; i < MLDSA_L; ++i)
   {
-    poly_uniform_gamma1(&v->vec[i], seed, MLDSA_L * nonce + i);
+    poly_uniform_gamma1_4x(&v0->vec[i], &v1->vec[i], &v2->vec[i], &v3->vec[i],
+                           seed0, seed1, seed2, seed3, nonce0 + i, nonce1 + i,
+                           nonce2 + i, nonce3 + i);
   }
 }
 
@@ -146,6 +265,34 @@ void polyvecl_pointwise_poly_montgomery(polyvecl *r, const poly *a,
   }
 }
 
+#if MLDSA_L == 4 && \
+    defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L4)
+void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
+                                       const polyvecl *v)
+{
+  polyvecl_pointwise_acc_montgomery_l4_native(
+      w->coeffs, (const int32_t(*)[MLDSA_N])u->vec,
+      (const int32_t(*)[MLDSA_N])v->vec);
+}
+#elif MLDSA_L == 5 && \
+    defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L5)
+void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
+                                       const polyvecl *v)
+{
+  polyvecl_pointwise_acc_montgomery_l5_native(
+      w->coeffs, (const int32_t(*)[MLDSA_N])u->vec,
+      (const int32_t(*)[MLDSA_N])v->vec);
+}
+#elif MLDSA_L == 7 && \
+    defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY_L7)
+void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
+                                       const polyvecl *v)
+{
+  polyvecl_pointwise_acc_montgomery_l7_native(
+      w->coeffs, (const int32_t(*)[MLDSA_N])u->vec,
+      (const int32_t(*)[MLDSA_N])v->vec);
+}
+#else
 void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
                                        const polyvecl *v)
 {
@@ -159,6 +306,7 @@ void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
     poly_add(w, w, &t);
   }
 }
+#endif /* MLDSA_L == ... */
 
 
 int polyvecl_chknorm(const polyvecl *v, int32_t bound)
@@ -180,17 +328,6 @@ int polyvecl_chknorm(const polyvecl *v, int32_t bound)
 /************ Vectors of polynomials of length MLDSA_K **************/
 /**************************************************************/
 
-void polyveck_uniform_eta(polyveck *v, const uint8_t seed[MLDSA_CRHBYTES],
-                          uint16_t nonce)
-{
-  unsigned int i;
-
-  for (i = 0; i < MLDSA_K; ++i)
-  {
-    poly_uniform_eta(&v->vec[i], seed, nonce++);
-  }
-}
-
 void polyveck_reduce(polyveck *v)
 {
   unsigned int i;
@@ -16,14 +16,31 @@ typedef struct
   poly vec[MLDSA_L];
 } polyvecl;
 
-#define polyvecl_uniform_eta MLD_NAMESPACE(polyvecl_uniform_eta)
-void polyvecl_uniform_eta(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
-                          uint16_t nonce);
-
 #define polyvecl_uniform_gamma1 MLD_NAMESPACE(polyvecl_uniform_gamma1)
 void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
                              uint16_t nonce);
 
+#define polyvecl_uniform_gamma1_4x MLD_NAMESPACE(polyvecl_uniform_gamma1_4x)
+/*************************************************
+ * Name:        polyvecl_uniform_gamma1_4x
+ *
+ * Description: Four calls of polyvecl_uniform_gamma1() with independent
+ *              seeds and nonces, using 4-way batched Keccak.
+ *
+ * Arguments:   - polyvecl *v0, ..., *v3: pointers to output vectors
+ *              - const uint8_t seed0[], ..., seed3[]: byte arrays with
+ *                seeds of length MLDSA_CRHBYTES
+ *              - uint16_t nonce0, ..., nonce3: 16-bit nonces
+ **************************************************/
+void polyvecl_uniform_gamma1_4x(polyvecl *v0, polyvecl *v1, polyvecl *v2,
+                                polyvecl *v3,
+                                const uint8_t seed0[MLDSA_CRHBYTES],
+                                const uint8_t seed1[MLDSA_CRHBYTES],
+                                const uint8_t seed2[MLDSA_CRHBYTES],
+                                const uint8_t seed3[MLDSA_CRHBYTES],
+                                uint16_t nonce0, uint16_t nonce1,
+                                uint16_t nonce2, uint16_t nonce3);
+
 #define polyvecl_reduce MLD_NAMESPACE(polyvecl_reduce)
 /*************************************************
  * Name:        polyvecl_reduce
@@ -164,10 +181,6 @@ typedef struct
   poly vec[MLDSA_K];
 } polyveck;
 
-#define polyveck_uniform_eta MLD_NAMESPACE(polyveck_uniform_eta)
-void polyveck_uniform_eta(polyveck *v, const uint8_t seed[MLDSA_CRHBYTES],
-                          uint16_t nonce);
-
 #define polyveck_reduce MLD_NAMESPACE(polyveck_reduce)
 /*************************************************
  * Name:        polyveck_reduce
@@ -559,6 +572,20 @@ __contract__(
     array_bound(p->vec[k1].coeffs, 0, MLDSA_N, -(1<<(MLDSA_D-1)) + 1, (1<<(MLDSA_D-1)) + 1)))
 );
 
+/* Matrix A in NTT domain. With MLD_CONFIG_REDUCE_RAM, only the seed rho
+ * is stored, and the entries are sampled whenever they are used. */
+#if !defined(MLD_CONFIG_REDUCE_RAM)
+typedef struct
+{
+  polyvecl vec[MLDSA_K];
+} polymat;
+#else  /* !MLD_CONFIG_REDUCE_RAM */
+typedef struct
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+} polymat;
+#endif /* MLD_CONFIG_REDUCE_RAM */
+
 #define polyvec_matrix_expand MLD_NAMESPACE(polyvec_matrix_expand)
 /*************************************************
  * Name:        polyvec_matrix_expand
@@ -567,16 +594,54 @@ __contract__(
  *              random coefficients a_{i,j} by performing rejection
  *              sampling on the output stream of SHAKE128(rho|j|i)
  *
- * Arguments:   - polyvecl mat[MLDSA_K]: output matrix
+ *              With MLD_CONFIG_REDUCE_RAM, only rho is copied, and the
+ *              sampling is deferred to polyvec_matrix_pointwise_montgomery().
+ *
+ * Arguments:   - polymat *mat: pointer to output matrix
  *              - const uint8_t rho[]: byte array containing seed rho
  **************************************************/
-void polyvec_matrix_expand(polyvecl mat[MLDSA_K],
-                           const uint8_t rho[MLDSA_SEEDBYTES]);
+void polyvec_matrix_expand(polymat *mat, const uint8_t rho[MLDSA_SEEDBYTES]);
+
+#define polyvec_uniform_eta MLD_NAMESPACE(polyvec_uniform_eta)
+/*************************************************
+ * Name:        polyvec_uniform_eta
+ *
+ * Description: Samples the secret vectors s1 and s2 with uniformly random
+ *              coefficients in [-MLDSA_ETA,MLDSA_ETA], using nonces
+ *              0, ..., MLDSA_L - 1 for s1 and MLDSA_L, ...,
+ *              MLDSA_L + MLDSA_K - 1 for s2.
+ *
+ *              The MLDSA_L + MLDSA_K streams are computed in groups of
+ *              four using 4-way batched Keccak. The result is the same as
+ *              for sampling every polynomial with poly_uniform_eta().
+ *
+ * Arguments:   - polyvecl *s1: pointer to output vector s1
+ *              - polyveck *s2: pointer to output vector s2
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_CRHBYTES
+ **************************************************/
+void polyvec_uniform_eta(polyvecl *s1, polyveck *s2,
+                         const uint8_t seed[MLDSA_CRHBYTES]);
 
 #define polyvec_matrix_pointwise_montgomery \
   MLD_NAMESPACE(polyvec_matrix_pointwise_montgomery)
-void polyvec_matrix_pointwise_montgomery(polyveck *t,
-                                         const polyvecl mat[MLDSA_K],
+/*************************************************
+ * Name:        polyvec_matrix_pointwise_montgomery
+ *
+ * Description: Computes the matrix-vector product t = A * v in NTT domain,
+ *              with multiplication by 2^{-32}. The output is
+ *              coefficient-wise bound by MLDSA_L * MLDSA_Q in absolute
+ *              value.
+ *
+ *              With MLD_CONFIG_REDUCE_RAM, every entry of A is sampled
+ *              from rho just before it is used, so that at most two
+ *              polynomials are held besides t and v.
+ *
+ * Arguments:   - polyveck *t: pointer to output vector
+ *              - const polymat *mat: pointer to matrix A
+ *              - const polyvecl *v: pointer to input vector in NTT domain
+ **************************************************/
+void polyvec_matrix_pointwise_montgomery(polyveck *t, const polymat *mat,
                                          const polyvecl *v);
 
 #endif /* !MLD_POLYVEC_H */
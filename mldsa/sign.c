@@ -7,6 +7,7 @@
 
 #include "cbmc.h"
 #include "fips202/fips202.h"
+#include "fips202/fips202x4.h"
 #include "packing.h"
 #include "poly.h"
 #include "polyvec.h"
@@ -14,15 +15,62 @@
 #include "sign.h"
 #include "symmetric.h"
 
-int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
-                                 const uint8_t seed[MLDSA_SEEDBYTES])
+/* Length of the input mu || w1 of the challenge hash */
+#define MLD_W1_HASHBYTES (MLDSA_CRHBYTES + MLDSA_K * MLDSA_POLYW1_PACKEDBYTES)
+
+/* Temporaries of verification, see mld_verify_challenge(). z and h hold
+ * the unpacked signature. */
+typedef struct
+{
+  polyvecl z;
+  polyveck h, w1, ct1;
+  poly cp;
+} mld_verify_scratch;
+
+/* Workspace of crypto_sign_keypair_internal_ws() */
+typedef struct
+{
+  polymat mat;
+  polyvecl s1, s1hat;
+  polyveck s2, t1, t0;
+} mld_keypair_ws;
+
+/* Workspace of crypto_sign_signature_internal_ws() */
+typedef struct
+{
+  mld_expanded_sk esk;
+  mld_sign_scratch tmp;
+} mld_sign_ws;
+
+/* Workspace of crypto_sign_verify_internal_ws() */
+typedef struct
+{
+  polymat mat;
+  polyveck t1;
+  mld_verify_scratch tmp;
+} mld_verify_ws;
+
+/* A caller-provided workspace is used by one operation at a time */
+typedef union
+{
+  mld_keypair_ws keypair;
+  mld_sign_ws sign;
+  mld_verify_ws verify;
+} mld_workspace;
+
+size_t crypto_sign_workspace_size(void)
+{
+  return MLD_ALIGN_UP(sizeof(mld_workspace));
+}
+
+int crypto_sign_keypair_internal_ws(uint8_t *pk, uint8_t *sk,
+                                    const uint8_t seed[MLDSA_SEEDBYTES],
+                                    void *ws)
 {
   uint8_t seedbuf[2 * MLDSA_SEEDBYTES + MLDSA_CRHBYTES];
   uint8_t tr[MLDSA_TRBYTES];
   const uint8_t *rho, *rhoprime, *key;
-  polyvecl mat[MLDSA_K];
-  polyvecl s1, s1hat;
-  polyveck s2, t1, t0;
+  mld_keypair_ws *w = &((mld_workspace *)ws)->keypair;
 
   /* Get randomness for rho, rhoprime and key */
   memcpy(seedbuf, seed, MLDSA_SEEDBYTES);
@@ -35,67 +83,82 @@ int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
   key = rhoprime + MLDSA_CRHBYTES;
 
   /* Expand matrix */
-  polyvec_matrix_expand(mat, rho);
+  polyvec_matrix_expand(&w->mat, rho);
 
   /* Sample short vectors s1 and s2 */
-  polyvecl_uniform_eta(&s1, rhoprime, 0);
-  polyveck_uniform_eta(&s2, rhoprime, MLDSA_L);
+  polyvec_uniform_eta(&w->s1, &w->s2, rhoprime);
 
   /* Matrix-vector multiplication */
-  s1hat = s1;
-  polyvecl_ntt(&s1hat);
-  polyvec_matrix_pointwise_montgomery(&t1, mat, &s1hat);
-  polyveck_reduce(&t1);
-  polyveck_invntt_tomont(&t1);
+  w->s1hat = w->s1;
+  polyvecl_ntt(&w->s1hat);
+  polyvec_matrix_pointwise_montgomery(&w->t1, &w->mat, &w->s1hat);
+  polyveck_reduce(&w->t1);
+  polyveck_invntt_tomont(&w->t1);
 
   /* Add error vector s2 */
-  polyveck_add(&t1, &t1, &s2);
+  polyveck_add(&w->t1, &w->t1, &w->s2);
 
   /* Extract t1 and write public key */
-  polyveck_caddq(&t1);
-  polyveck_power2round(&t1, &t0, &t1);
-  pack_pk(pk, rho, &t1);
+  polyveck_caddq(&w->t1);
+  polyveck_power2round(&w->t1, &w->t0, &w->t1);
+  pack_pk(pk, rho, &w->t1);
 
   /* Compute H(rho, t1) and write secret key */
   shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-  pack_sk(sk, rho, tr, key, &t0, &s1, &s2);
+  pack_sk(sk, rho, tr, key, &w->t0, &w->s1, &w->s2);
   return 0;
 }
 
-int crypto_sign_keypair(uint8_t *pk, uint8_t *sk)
+int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
+                                 const uint8_t seed[MLDSA_SEEDBYTES])
+{
+  mld_keypair_ws ws;
+  return crypto_sign_keypair_internal_ws(pk, sk, seed, &ws);
+}
+
+int crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws)
 {
   uint8_t seed[MLDSA_SEEDBYTES];
   randombytes(seed, MLDSA_SEEDBYTES);
-  return crypto_sign_keypair_internal(pk, sk, seed);
+  return crypto_sign_keypair_internal_ws(pk, sk, seed, ws);
 }
 
-int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
-                                   const uint8_t *m, size_t mlen,
-                                   const uint8_t *pre, size_t prelen,
-                                   const uint8_t rnd[MLDSA_RNDBYTES],
-                                   const uint8_t *sk, int externalmu)
+int crypto_sign_keypair(uint8_t *pk, uint8_t *sk)
 {
-  unsigned int n;
-  uint8_t seedbuf[2 * MLDSA_SEEDBYTES + MLDSA_TRBYTES + 2 * MLDSA_CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
-  uint16_t nonce = 0;
-  polyvecl mat[MLDSA_K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
-  poly cp;
-  keccak_state state;
+  mld_keypair_ws ws;
+  return crypto_sign_keypair_ws(pk, sk, &ws);
+}
 
-  rho = seedbuf;
-  tr = rho + MLDSA_SEEDBYTES;
-  key = tr + MLDSA_TRBYTES;
-  mu = key + MLDSA_SEEDBYTES;
-  rhoprime = mu + MLDSA_CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+int crypto_sign_expand_sk(mld_expanded_sk *esk, const uint8_t *sk)
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+
+  unpack_sk(rho, esk->tr, esk->key, &esk->t0, &esk->s1, &esk->s2, sk);
+
+  /* Expand matrix and transform vectors */
+  polyvec_matrix_expand(&esk->mat, rho);
+#if !defined(MLD_SIGN_SPARSE_CHALLENGE)
+  polyvecl_ntt(&esk->s1);
+  polyveck_ntt(&esk->s2);
+  polyveck_ntt(&esk->t0);
+#endif
+  return 0;
+}
+
+void crypto_sign_signature_seeds(uint8_t mu[MLDSA_CRHBYTES],
+                                 uint8_t rhoprime[MLDSA_CRHBYTES],
+                                 const uint8_t *m, size_t mlen,
+                                 const uint8_t *pre, size_t prelen,
+                                 const uint8_t rnd[MLDSA_RNDBYTES],
+                                 const mld_expanded_sk *esk, int externalmu)
+{
+  keccak_state state;
 
   if (!externalmu)
   {
     /* Compute mu = CRH(tr, pre, msg) */
     shake256_init(&state);
-    shake256_absorb(&state, tr, MLDSA_TRBYTES);
+    shake256_absorb(&state, esk->tr, MLDSA_TRBYTES);
     shake256_absorb(&state, pre, prelen);
     shake256_absorb(&state, m, mlen);
     shake256_finalize(&state);
@@ -109,117 +172,349 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
 
   /* Compute rhoprime = CRH(key, rnd, mu) */
   shake256_init(&state);
-  shake256_absorb(&state, key, MLDSA_SEEDBYTES);
+  shake256_absorb(&state, esk->key, MLDSA_SEEDBYTES);
   shake256_absorb(&state, rnd, MLDSA_RNDBYTES);
   shake256_absorb(&state, mu, MLDSA_CRHBYTES);
   shake256_finalize(&state);
   shake256_squeeze(rhoprime, MLDSA_CRHBYTES, &state);
+}
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
+/*************************************************
+ * Name:        mld_sign_w1
+ *
+ * Description: Computes w = Ay for the masking vector in tmp->y, and
+ *              decomposes it into tmp->w1 and tmp->w0.
+ *
+ * Arguments:   - uint8_t *w1buf: output packed w1 of length
+ *                                MLDSA_K * MLDSA_POLYW1_PACKEDBYTES
+ *              - const mld_expanded_sk *esk: pointer to expanded key
+ *              - mld_sign_scratch *tmp: pointer to temporaries
+ **************************************************/
+static void mld_sign_w1(uint8_t *w1buf, const mld_expanded_sk *esk,
+                        mld_sign_scratch *tmp)
+{
+  /* Matrix-vector multiplication */
+  tmp->z = tmp->y;
+  polyvecl_ntt(&tmp->z);
+  polyvec_matrix_pointwise_montgomery(&tmp->w1, &esk->mat, &tmp->z);
+  polyveck_reduce(&tmp->w1);
+  polyveck_invntt_tomont(&tmp->w1);
 
-rej:
-  /* Sample intermediate vector y */
-  polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
+  /* Decompose w */
+  polyveck_caddq(&tmp->w1);
+  polyveck_decompose(&tmp->w1, &tmp->w0, &tmp->w1);
+  polyveck_pack_w1(w1buf, &tmp->w1);
+}
 
-  /* Matrix-vector multiplication */
-  z = y;
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
-  polyveck_reduce(&w1);
-  polyveck_invntt_tomont(&w1);
+#if defined(MLD_CONFIG_SIGN_STATS)
+static MLD_THREAD_LOCAL mld_sign_stats mld_sign_stats_local;
+#define MLD_SIGN_STATS_COUNT(field) (mld_sign_stats_local.field++)
+
+void mld_sign_stats_get(mld_sign_stats *stats)
+{
+  *stats = mld_sign_stats_local;
+}
 
-  /* Decompose w and call the random oracle */
-  polyveck_caddq(&w1);
-  polyveck_decompose(&w1, &w0, &w1);
-  polyveck_pack_w1(sig, &w1);
+void mld_sign_stats_reset(void)
+{
+  memset(&mld_sign_stats_local, 0, sizeof(mld_sign_stats_local));
+}
+#else /* MLD_CONFIG_SIGN_STATS */
+#define MLD_SIGN_STATS_COUNT(field) \
+  do                                \
+  {                                 \
+  } while (0)
+#endif /* !MLD_CONFIG_SIGN_STATS */
 
-  shake256_init(&state);
-  shake256_absorb(&state, mu, MLDSA_CRHBYTES);
-  shake256_absorb(&state, sig, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
-  shake256_finalize(&state);
-  shake256_squeeze(sig, MLDSA_CTILDEBYTES, &state);
-  poly_challenge(&cp, sig);
-  poly_ntt(&cp);
+/*************************************************
+ * Name:        mld_sign_challenge_mul
+ *
+ * Description: Multiplies a polynomial of the expanded key by the
+ *              challenge polynomial prepared in tmp, either sparse in the
+ *              normal domain or through the NTT. The result is not
+ *              reduced.
+ **************************************************/
+static void mld_sign_challenge_mul(poly *r, const mld_sign_scratch *tmp,
+                                   const poly *a)
+{
+#if defined(MLD_SIGN_SPARSE_CHALLENGE)
+  poly_sparse_mul(r, &tmp->cs, a);
+#else
+  poly_pointwise_montgomery(r, &tmp->cp, a);
+  poly_invntt_tomont(r);
+#endif
+}
+
+/*************************************************
+ * Name:        mld_sign_respond
+ *
+ * Description: Second half of a signing attempt: computes the response
+ *              and the hints for the challenge polynomial in tmp->cp, and
+ *              checks whether they may be released.
+ *
+ *              The checks run in the order of the reference
+ *              implementation: z, r0, ct0, and then the number of hints.
+ *              Within each, every polynomial is checked as soon as it is
+ *              computed, and the attempt is abandoned at the first
+ *              violation, so a rejected attempt skips the remaining
+ *              multiplications by the challenge. The time taken therefore
+ *              reveals which check failed, and for which polynomial. This
+ *              is acceptable: a rejected attempt is discarded, every
+ *              attempt uses a fresh y, and the rejection of an attempt
+ *              leaks nothing about the secret key beyond what the released
+ *              values already do.
+ *
+ * Arguments:   - uint8_t *sig: output signature, only written if accepted
+ *              - const uint8_t *c: challenge seed; may alias sig
+ *              - const mld_expanded_sk *esk: pointer to expanded key
+ *              - mld_sign_scratch *tmp: pointer to temporaries, with y,
+ *                                       w1, w0 and cp set
+ *
+ * Returns 0 if the attempt is accepted and -1 if it is rejected
+ **************************************************/
+static int mld_sign_respond(uint8_t *sig, const uint8_t c[MLDSA_CTILDEBYTES],
+                            const mld_expanded_sk *esk, mld_sign_scratch *tmp)
+{
+  unsigned int i, n;
+
+#if defined(MLD_SIGN_SPARSE_CHALLENGE)
+  poly_sparse_from_challenge(&tmp->cs, &tmp->cp);
+#else
+  poly_ntt(&tmp->cp);
+#endif
+  MLD_SIGN_STATS_COUNT(attempts);
 
   /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
-  polyvecl_invntt_tomont(&z);
-  polyvecl_add(&z, &z, &y);
-  polyvecl_reduce(&z);
-  if (polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA))
+  for (i = 0; i < MLDSA_L; i++)
   {
-    goto rej;
+    mld_sign_challenge_mul(&tmp->z.vec[i], tmp, &esk->s1.vec[i]);
+    poly_add(&tmp->z.vec[i], &tmp->z.vec[i], &tmp->y.vec[i]);
+    poly_reduce(&tmp->z.vec[i]);
+    if (poly_chknorm(&tmp->z.vec[i], MLDSA_GAMMA1 - MLDSA_BETA))
+    {
+      MLD_SIGN_STATS_COUNT(rejected_z);
+      return -1;
+    }
   }
 
   /* Check that subtracting cs2 does not change high bits of w and low bits
    * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
-  polyveck_invntt_tomont(&h);
-  polyveck_sub(&w0, &w0, &h);
-  polyveck_reduce(&w0);
-  if (polyveck_chknorm(&w0, MLDSA_GAMMA2 - MLDSA_BETA))
+  for (i = 0; i < MLDSA_K; i++)
   {
-    goto rej;
+    mld_sign_challenge_mul(&tmp->h.vec[i], tmp, &esk->s2.vec[i]);
+    poly_sub(&tmp->w0.vec[i], &tmp->w0.vec[i], &tmp->h.vec[i]);
+    poly_reduce(&tmp->w0.vec[i]);
+    if (poly_chknorm(&tmp->w0.vec[i], MLDSA_GAMMA2 - MLDSA_BETA))
+    {
+      MLD_SIGN_STATS_COUNT(rejected_r0);
+      return -1;
+    }
   }
 
-  /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
-  polyveck_invntt_tomont(&h);
-  polyveck_reduce(&h);
-  if (polyveck_chknorm(&h, MLDSA_GAMMA2))
+  /* Compute ct0, reject if it is too large */
+  for (i = 0; i < MLDSA_K; i++)
   {
-    goto rej;
+    mld_sign_challenge_mul(&tmp->h.vec[i], tmp, &esk->t0.vec[i]);
+    poly_reduce(&tmp->h.vec[i]);
+    if (poly_chknorm(&tmp->h.vec[i], MLDSA_GAMMA2))
+    {
+      MLD_SIGN_STATS_COUNT(rejected_ct0);
+      return -1;
+    }
   }
 
-  polyveck_add(&w0, &w0, &h);
-  n = polyveck_make_hint(&h, &w0, &w1);
-  if (n > MLDSA_OMEGA)
+  /* Compute hints for w1, reject as soon as there are too many of them */
+  n = 0;
+  for (i = 0; i < MLDSA_K; i++)
   {
-    goto rej;
+    poly_add(&tmp->w0.vec[i], &tmp->w0.vec[i], &tmp->h.vec[i]);
+    n += poly_make_hint(&tmp->h.vec[i], &tmp->w0.vec[i], &tmp->w1.vec[i]);
+    if (n > MLDSA_OMEGA)
+    {
+      MLD_SIGN_STATS_COUNT(rejected_hint);
+      return -1;
+    }
   }
 
   /* Write signature */
-  pack_sig(sig, sig, &z, &h, n);
+  pack_sig(sig, c, &tmp->z, &tmp->h, n);
+  return 0;
+}
+
+int crypto_sign_signature_attempt(uint8_t *sig, const mld_expanded_sk *esk,
+                                  const uint8_t mu[MLDSA_CRHBYTES],
+                                  const uint8_t rhoprime[MLDSA_CRHBYTES],
+                                  uint16_t nonce, mld_sign_scratch *tmp)
+{
+  keccak_state state;
+
+  /* Sample intermediate vector y */
+  polyvecl_uniform_gamma1(&tmp->y, rhoprime, nonce);
+  mld_sign_w1(sig, esk, tmp);
+
+  /* Call the random oracle */
+  shake256_init(&state);
+  shake256_absorb(&state, mu, MLDSA_CRHBYTES);
+  shake256_absorb(&state, sig, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
+  shake256_finalize(&state);
+  shake256_squeeze(sig, MLDSA_CTILDEBYTES, &state);
+  poly_challenge(&tmp->cp, sig);
+
+  return mld_sign_respond(sig, sig, esk, tmp);
+}
+
+/*************************************************
+ * Name:        mld_sign_expanded
+ *
+ * Description: Signing with an expanded secret key, see
+ *              crypto_sign_signature_expanded_internal(). The large
+ *              temporaries of the rejection loop live in *tmp.
+ **************************************************/
+static int mld_sign_expanded(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                             size_t mlen, const uint8_t *pre, size_t prelen,
+                             const uint8_t rnd[MLDSA_RNDBYTES],
+                             const mld_expanded_sk *esk, int externalmu,
+                             mld_sign_scratch *tmp)
+{
+  uint8_t mu[MLDSA_CRHBYTES], rhoprime[MLDSA_CRHBYTES];
+  uint16_t nonce = 0;
+
+  crypto_sign_signature_seeds(mu, rhoprime, m, mlen, pre, prelen, rnd, esk,
+                              externalmu);
+
+  /* Attempts with nonce 0, 1, 2, ... until one is accepted */
+  while (crypto_sign_signature_attempt(sig, esk, mu, rhoprime, nonce, tmp))
+  {
+    nonce++;
+  }
+
   *siglen = CRYPTO_BYTES;
   return 0;
 }
 
-int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
-                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
-                          const uint8_t *sk)
+int crypto_sign_signature_expanded_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const mld_expanded_sk *esk, int externalmu)
+{
+  mld_sign_scratch tmp;
+  return mld_sign_expanded(sig, siglen, m, mlen, pre, prelen, rnd, esk,
+                           externalmu, &tmp);
+}
+
+int crypto_sign_signature_internal_ws(uint8_t *sig, size_t *siglen,
+                                      const uint8_t *m, size_t mlen,
+                                      const uint8_t *pre, size_t prelen,
+                                      const uint8_t rnd[MLDSA_RNDBYTES],
+                                      const uint8_t *sk, int externalmu,
+                                      void *ws)
+{
+  mld_sign_ws *w = &((mld_workspace *)ws)->sign;
+
+  crypto_sign_expand_sk(&w->esk, sk);
+  return mld_sign_expanded(sig, siglen, m, mlen, pre, prelen, rnd, &w->esk,
+                           externalmu, &w->tmp);
+}
+
+int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *pre, size_t prelen,
+                                   const uint8_t rnd[MLDSA_RNDBYTES],
+                                   const uint8_t *sk, int externalmu)
+{
+  mld_sign_ws ws;
+  return crypto_sign_signature_internal_ws(sig, siglen, m, mlen, pre, prelen,
+                                           rnd, sk, externalmu, &ws);
+}
+
+/*************************************************
+ * Name:        mld_prepare_pre
+ *
+ * Description: Prepares the prefix pre = (0, ctxlen, ctx) of the message
+ *              in the pure variants of signing and verification
+ *              [FIPS 204, Algorithms 2 and 3].
+ *
+ * Arguments:   - uint8_t *pre:       output prefix of 2 + ctxlen bytes
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen:      length of context string
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+static int mld_prepare_pre(uint8_t pre[257], const uint8_t *ctx,
+                           size_t ctxlen)
 {
   size_t i;
-  uint8_t pre[257];
-  uint8_t rnd[MLDSA_RNDBYTES];
 
   if (ctxlen > 255)
   {
     return -1;
   }
 
-  /* Prepare pre = (0, ctxlen, ctx) */
   pre[0] = 0;
-  pre[1] = ctxlen;
+  pre[1] = (uint8_t)ctxlen;
   for (i = 0; i < ctxlen; i++)
   {
     pre[2 + i] = ctx[i];
   }
+  return 0;
+}
 
+/*************************************************
+ * Name:        mld_prepare_rnd
+ *
+ * Description: Prepares the per-signature randomness rnd: random bytes
+ *              for hedged signing, or all zero for deterministic signing
+ *              if MLD_RANDOMIZED_SIGNING is not set.
+ *
+ * Arguments:   - uint8_t *rnd: output randomness of MLDSA_RNDBYTES bytes
+ **************************************************/
+static void mld_prepare_rnd(uint8_t rnd[MLDSA_RNDBYTES])
+{
 #ifdef MLD_RANDOMIZED_SIGNING
   randombytes(rnd, MLDSA_RNDBYTES);
 #else
+  size_t i;
   for (i = 0; i < MLDSA_RNDBYTES; i++)
   {
     rnd[i] = 0;
   }
 #endif /* !MLD_RANDOMIZED_SIGNING */
+}
 
-  crypto_sign_signature_internal(sig, siglen, m, mlen, pre, 2 + ctxlen, rnd, sk,
-                                 0);
+int crypto_sign_prepare(uint8_t pre[257], uint8_t rnd[MLDSA_RNDBYTES],
+                        const uint8_t *ctx, size_t ctxlen)
+{
+  if (mld_prepare_pre(pre, ctx, ctxlen) != 0)
+  {
+    return -1;
+  }
+  mld_prepare_rnd(rnd);
+  return 0;
+}
+
+int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                          const uint8_t *sk)
+{
+  mld_sign_ws ws;
+  return crypto_sign_signature_ws(sig, siglen, m, mlen, ctx, ctxlen, sk, &ws);
+}
+
+int crypto_sign_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                             size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *sk, void *ws)
+{
+  uint8_t pre[257];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (mld_prepare_pre(pre, ctx, ctxlen) != 0)
+  {
+    return -1;
+  }
+  mld_prepare_rnd(rnd);
+
+  crypto_sign_signature_internal_ws(sig, siglen, m, mlen, pre, 2 + ctxlen, rnd,
+                                    sk, 0, ws);
   return 0;
 }
 
@@ -229,20 +524,320 @@ int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
 {
   uint8_t rnd[MLDSA_RNDBYTES];
 
-#ifdef MLD_RANDOMIZED_SIGNING
-  randombytes(rnd, MLDSA_RNDBYTES);
-#else
-  size_t i;
-  for (i = 0; i < MLDSA_RNDBYTES; i++)
+  mld_prepare_rnd(rnd);
+  crypto_sign_signature_internal(sig, siglen, mu, 0, NULL, 0, rnd, sk, 1);
+  return 0;
+}
+
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const mld_expanded_sk *esk)
+{
+  uint8_t pre[257];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (mld_prepare_pre(pre, ctx, ctxlen) != 0)
   {
-    rnd[i] = 0;
+    return -1;
   }
-#endif /* !MLD_RANDOMIZED_SIGNING */
+  mld_prepare_rnd(rnd);
 
-  crypto_sign_signature_internal(sig, siglen, mu, 0, NULL, 0, rnd, sk, 1);
+  crypto_sign_signature_expanded_internal(sig, siglen, m, mlen, pre,
+                                          2 + ctxlen, rnd, esk, 0);
   return 0;
 }
 
+/* Messages for which tr || pre || m is at most this long have mu computed
+ * four at a time, if the lengths within a group of four agree */
+#define MLD_SIGN_BATCH_MUBYTES (4 * SHAKE256_RATE)
+
+#define MLD_SIGN_BATCH_IDLE ((size_t)-1)
+
+/* One lane of batch signing: the message sig[idx] being signed, with its
+ * current nonce and seeds. buf holds mu || w1 as input to the challenge
+ * hash. */
+typedef struct
+{
+  size_t idx;
+  uint16_t nonce;
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  MLD_ALIGN uint8_t buf[MLD_ALIGN_UP(MLD_W1_HASHBYTES)];
+  MLD_ALIGN uint8_t c[MLD_ALIGN_UP(SHAKE256_RATE)];
+  mld_sign_scratch tmp;
+} mld_sign_lane;
+
+/* Workspace of crypto_sign_signature_batch_ws() */
+typedef struct
+{
+  mld_expanded_sk esk;
+  mld_sign_lane l[4];
+} mld_sign_batch_ws;
+
+size_t crypto_sign_batch_workspace_size(void)
+{
+  return MLD_ALIGN_UP(sizeof(mld_sign_batch_ws));
+}
+
+/*************************************************
+ * Name:        mld_sign_batch_seeds_x4
+ *
+ * Description: Computes mu and rhoprime of up to four messages, as
+ *              crypto_sign_signature_seeds() does, and stores mu ||
+ *              rhoprime at the start of their signature buffers.
+ *              rhoprime, and mu for four short messages of equal length,
+ *              are computed with 4-way batched SHAKE256.
+ *
+ * Arguments:   - size_t n: number of messages, 1 <= n <= 4
+ *              - other arguments as for
+ *                crypto_sign_signature_batch_expanded()
+ **************************************************/
+static void mld_sign_batch_seeds_x4(uint8_t *const *sig,
+                                    const uint8_t *const *m,
+                                    const size_t *mlen,
+                                    const uint8_t *const *ctx,
+                                    const size_t *ctxlen, size_t n,
+                                    const mld_expanded_sk *esk)
+{
+  unsigned int k;
+  size_t len;
+  uint8_t pre[2];
+  MLD_ALIGN uint8_t in[4][MLD_ALIGN_UP(MLD_SIGN_BATCH_MUBYTES)];
+  MLD_ALIGN uint8_t out[4][MLD_ALIGN_UP(SHAKE256_RATE)];
+  keccak_state state;
+  keccakx4_state statex4;
+
+  /* Compute mu = CRH(tr, pre, msg) */
+  len = MLDSA_TRBYTES + 2 + ctxlen[0] + mlen[0];
+  for (k = 1; k < n; k++)
+  {
+    if (MLDSA_TRBYTES + 2 + ctxlen[k] + mlen[k] != len)
+    {
+      len = 0;
+    }
+  }
+
+  if (n == 4 && len != 0 && len <= MLD_SIGN_BATCH_MUBYTES)
+  {
+    for (k = 0; k < 4; k++)
+    {
+      memcpy(in[k], esk->tr, MLDSA_TRBYTES);
+      in[k][MLDSA_TRBYTES] = 0;
+      in[k][MLDSA_TRBYTES + 1] = (uint8_t)ctxlen[k];
+      memcpy(in[k] + MLDSA_TRBYTES + 2, ctx[k], ctxlen[k]);
+      memcpy(in[k] + MLDSA_TRBYTES + 2 + ctxlen[k], m[k], mlen[k]);
+    }
+    shake256x4_absorb_once(&statex4, in[0], in[1], in[2], in[3], len);
+    shake256x4_squeezeblocks(out[0], out[1], out[2], out[3], 1, &statex4);
+    for (k = 0; k < 4; k++)
+    {
+      memcpy(sig[k], out[k], MLDSA_CRHBYTES);
+    }
+  }
+  else
+  {
+    for (k = 0; k < n; k++)
+    {
+      pre[0] = 0;
+      pre[1] = (uint8_t)ctxlen[k];
+      shake256_init(&state);
+      shake256_absorb(&state, esk->tr, MLDSA_TRBYTES);
+      shake256_absorb(&state, pre, 2);
+      shake256_absorb(&state, ctx[k], ctxlen[k]);
+      shake256_absorb(&state, m[k], mlen[k]);
+      shake256_finalize(&state);
+      shake256_squeeze(sig[k], MLDSA_CRHBYTES, &state);
+    }
+  }
+
+  /* Compute rhoprime = CRH(key, rnd, mu), drawing rnd in message order.
+   * Unused lanes hash zeros. */
+  for (k = 0; k < 4; k++)
+  {
+    memset(in[k], 0, 2 * MLDSA_SEEDBYTES + MLDSA_CRHBYTES);
+    if (k >= n)
+    {
+      continue;
+    }
+    memcpy(in[k], esk->key, MLDSA_SEEDBYTES);
+    mld_prepare_rnd(in[k] + MLDSA_SEEDBYTES);
+    memcpy(in[k] + MLDSA_SEEDBYTES + MLDSA_RNDBYTES, sig[k], MLDSA_CRHBYTES);
+  }
+  shake256x4_absorb_once(&statex4, in[0], in[1], in[2], in[3],
+                         MLDSA_SEEDBYTES + MLDSA_RNDBYTES + MLDSA_CRHBYTES);
+  shake256x4_squeezeblocks(out[0], out[1], out[2], out[3], 1, &statex4);
+  for (k = 0; k < n; k++)
+  {
+    memcpy(sig[k] + MLDSA_CRHBYTES, out[k], MLDSA_CRHBYTES);
+  }
+}
+
+/*************************************************
+ * Name:        mld_sign_lane_fill
+ *
+ * Description: Starts signing the message with index idx in lane l, with
+ *              the seeds stored in its signature buffer, or marks the lane
+ *              as idle if idx is MLD_SIGN_BATCH_IDLE.
+ **************************************************/
+static void mld_sign_lane_fill(mld_sign_lane *l, uint8_t *const *sig,
+                               size_t idx)
+{
+  l->idx = idx;
+  l->nonce = 0;
+  if (idx == MLD_SIGN_BATCH_IDLE)
+  {
+    /* Idle lanes hash dummy inputs */
+    memset(l->rhoprime, 0, MLDSA_CRHBYTES);
+    memset(l->buf, 0, MLD_W1_HASHBYTES);
+    return;
+  }
+  memcpy(l->buf, sig[idx], MLDSA_CRHBYTES);
+  memcpy(l->rhoprime, sig[idx] + MLDSA_CRHBYTES, MLDSA_CRHBYTES);
+}
+
+/*************************************************
+ * Name:        mld_sign_batch
+ *
+ * Description: Batch signing with an expanded secret key, see
+ *              crypto_sign_signature_batch_expanded(). The four lanes,
+ *              which hold the large temporaries, live in l.
+ **************************************************/
+static int mld_sign_batch(uint8_t *const *sig, size_t *siglen,
+                          const uint8_t *const *m, const size_t *mlen,
+                          const uint8_t *const *ctx, const size_t *ctxlen,
+                          size_t n, const mld_expanded_sk *esk,
+                          mld_sign_lane l[4])
+{
+  unsigned int k, active;
+  size_t i, len, next;
+
+  for (i = 0; i < n; i++)
+  {
+    if (ctxlen[i] > 255)
+    {
+      return -1;
+    }
+  }
+
+  /* Compute the seeds of all messages into their signature buffers */
+  for (i = 0; i < n; i += len)
+  {
+    len = n - i < 4 ? n - i : 4;
+    mld_sign_batch_seeds_x4(sig + i, m + i, mlen + i, ctx + i, ctxlen + i,
+                            len, esk);
+  }
+
+  next = 0;
+  active = 0;
+  for (k = 0; k < 4; k++)
+  {
+    mld_sign_lane_fill(&l[k], sig, next < n ? next++ : MLD_SIGN_BATCH_IDLE);
+    active += l[k].idx != MLD_SIGN_BATCH_IDLE;
+  }
+
+  /* Run one attempt in every lane at a time. A lane whose attempt is
+   * accepted continues with the next message. */
+  while (active > 1)
+  {
+    polyvecl_uniform_gamma1_4x(&l[0].tmp.y, &l[1].tmp.y, &l[2].tmp.y,
+                               &l[3].tmp.y, l[0].rhoprime, l[1].rhoprime,
+                               l[2].rhoprime, l[3].rhoprime, l[0].nonce,
+                               l[1].nonce, l[2].nonce, l[3].nonce);
+    for (k = 0; k < 4; k++)
+    {
+      if (l[k].idx != MLD_SIGN_BATCH_IDLE)
+      {
+        mld_sign_w1(l[k].buf + MLDSA_CRHBYTES, esk, &l[k].tmp);
+      }
+    }
+
+    /* Call the random oracle */
+    {
+      keccakx4_state statex4;
+      shake256x4_absorb_once(&statex4, l[0].buf, l[1].buf, l[2].buf,
+                             l[3].buf, MLD_W1_HASHBYTES);
+      shake256x4_squeezeblocks(l[0].c, l[1].c, l[2].c, l[3].c, 1, &statex4);
+    }
+    poly_challenge_4x(&l[0].tmp.cp, &l[1].tmp.cp, &l[2].tmp.cp, &l[3].tmp.cp,
+                      l[0].c, l[1].c, l[2].c, l[3].c);
+
+    for (k = 0; k < 4; k++)
+    {
+      if (l[k].idx == MLD_SIGN_BATCH_IDLE)
+      {
+        continue;
+      }
+      if (mld_sign_respond(sig[l[k].idx], l[k].c, esk, &l[k].tmp))
+      {
+        l[k].nonce++;
+        continue;
+      }
+      siglen[l[k].idx] = CRYPTO_BYTES;
+      mld_sign_lane_fill(&l[k], sig, next < n ? next++ : MLD_SIGN_BATCH_IDLE);
+      active -= l[k].idx == MLD_SIGN_BATCH_IDLE;
+    }
+  }
+
+  /* The last message is cheaper to finish on its own */
+  for (k = 0; k < 4 && active == 1; k++)
+  {
+    if (l[k].idx != MLD_SIGN_BATCH_IDLE)
+    {
+      while (crypto_sign_signature_attempt(sig[l[k].idx], esk, l[k].buf,
+                                           l[k].rhoprime, l[k].nonce,
+                                           &l[k].tmp))
+      {
+        l[k].nonce++;
+      }
+      siglen[l[k].idx] = CRYPTO_BYTES;
+      active = 0;
+    }
+  }
+  return 0;
+}
+
+int crypto_sign_signature_batch_expanded(
+    uint8_t *const *sig, size_t *siglen, const uint8_t *const *m,
+    const size_t *mlen, const uint8_t *const *ctx, const size_t *ctxlen,
+    size_t n, const mld_expanded_sk *esk)
+{
+  mld_sign_lane l[4];
+  return mld_sign_batch(sig, siglen, m, mlen, ctx, ctxlen, n, esk, l);
+}
+
+int crypto_sign_signature_batch_expanded_ws(
+    uint8_t *const *sig, size_t *siglen, const uint8_t *const *m,
+    const size_t *mlen, const uint8_t *const *ctx, const size_t *ctxlen,
+    size_t n, const mld_expanded_sk *esk, void *ws)
+{
+  mld_sign_batch_ws *w = (mld_sign_batch_ws *)ws;
+  return mld_sign_batch(sig, siglen, m, mlen, ctx, ctxlen, n, esk, w->l);
+}
+
+int crypto_sign_signature_batch_ws(uint8_t *const *sig, size_t *siglen,
+                                   const uint8_t *const *m,
+                                   const size_t *mlen,
+                                   const uint8_t *const *ctx,
+                                   const size_t *ctxlen, size_t n,
+                                   const uint8_t *sk, void *ws)
+{
+  mld_sign_batch_ws *w = (mld_sign_batch_ws *)ws;
+
+  crypto_sign_expand_sk(&w->esk, sk);
+  return mld_sign_batch(sig, siglen, m, mlen, ctx, ctxlen, n, &w->esk, w->l);
+}
+
+int crypto_sign_signature_batch(uint8_t *const *sig, size_t *siglen,
+                                const uint8_t *const *m, const size_t *mlen,
+                                const uint8_t *const *ctx,
+                                const size_t *ctxlen, size_t n,
+                                const uint8_t *sk)
+{
+  mld_sign_batch_ws ws;
+  return crypto_sign_signature_batch_ws(sig, siglen, m, mlen, ctx, ctxlen, n,
+                                        sk, &ws);
+}
+
 int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                 const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
 {
@@ -259,33 +854,109 @@ int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
   return ret;
 }
 
-int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
-                                const uint8_t *m, size_t mlen,
-                                const uint8_t *pre, size_t prelen,
-                                const uint8_t *pk, int externalmu)
+/*************************************************
+ * Name:        mld_verify_w1
+ *
+ * Description: Reconstructs w1 from the signature and the public key.
+ *
+ * Arguments:   - uint8_t *buf: output buffer for packed w1
+ *              - const polymat *mat: pointer to matrix A
+ *              - const polyveck *t1: t1 * 2^d in NTT domain
+ *              - mld_verify_scratch *tmp: temporaries; on input, tmp->z,
+ *                tmp->h and tmp->cp hold response, hint and challenge
+ *                polynomial. tmp->z and tmp->cp are overwritten.
+ **************************************************/
+static void mld_verify_w1(uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES],
+                          const polymat *mat, const polyveck *t1,
+                          mld_verify_scratch *tmp)
+{
+  /* Matrix-vector multiplication; compute Az - c2^dt1 */
+  polyvecl_ntt(&tmp->z);
+  polyvec_matrix_pointwise_montgomery(&tmp->w1, mat, &tmp->z);
+
+  poly_ntt(&tmp->cp);
+  polyveck_pointwise_poly_montgomery(&tmp->ct1, &tmp->cp, t1);
+
+  polyveck_sub(&tmp->w1, &tmp->w1, &tmp->ct1);
+  polyveck_reduce(&tmp->w1);
+  polyveck_invntt_tomont(&tmp->w1);
+
+  /* Reconstruct w1 */
+  polyveck_caddq(&tmp->w1);
+  polyveck_use_hint(&tmp->w1, &tmp->w1, &tmp->h);
+  polyveck_pack_w1(buf, &tmp->w1);
+}
+
+/*************************************************
+ * Name:        mld_verify_challenge
+ *
+ * Description: Second half of verification: reconstructs w1 from the
+ *              signature and the public key, and checks that it hashes
+ *              to the challenge.
+ *
+ * Arguments:   - const uint8_t *c: challenge seed from the signature
+ *              - const uint8_t *mu: message representative
+ *              - const polymat *mat: pointer to matrix A
+ *              - const polyveck *t1: t1 * 2^d in NTT domain
+ *              - mld_verify_scratch *tmp: temporaries; on input, tmp->z
+ *                and tmp->h hold response and hint from the signature.
+ *                tmp->z is overwritten.
+ *
+ * Returns 0 if the challenge matches and -1 otherwise
+ **************************************************/
+static int mld_verify_challenge(const uint8_t c[MLDSA_CTILDEBYTES],
+                                const uint8_t mu[MLDSA_CRHBYTES],
+                                const polymat *mat, const polyveck *t1,
+                                mld_verify_scratch *tmp)
 {
   unsigned int i;
   uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES];
+  uint8_t c2[MLDSA_CTILDEBYTES];
+  keccak_state state;
+
+  poly_challenge(&tmp->cp, c);
+  mld_verify_w1(buf, mat, t1, tmp);
+
+  /* Call random oracle and verify challenge */
+  shake256_init(&state);
+  shake256_absorb(&state, mu, MLDSA_CRHBYTES);
+  shake256_absorb(&state, buf, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
+  shake256_finalize(&state);
+  shake256_squeeze(c2, MLDSA_CTILDEBYTES, &state);
+  for (i = 0; i < MLDSA_CTILDEBYTES; ++i)
+  {
+    if (c[i] != c2[i])
+    {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int crypto_sign_verify_internal_ws(const uint8_t *sig, size_t siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *pre, size_t prelen,
+                                   const uint8_t *pk, int externalmu,
+                                   void *ws)
+{
   uint8_t rho[MLDSA_SEEDBYTES];
   uint8_t mu[MLDSA_CRHBYTES];
   uint8_t c[MLDSA_CTILDEBYTES];
-  uint8_t c2[MLDSA_CTILDEBYTES];
-  poly cp;
-  polyvecl mat[MLDSA_K], z;
-  polyveck t1, w1, h;
   keccak_state state;
+  mld_verify_ws *w = &((mld_workspace *)ws)->verify;
 
   if (siglen != CRYPTO_BYTES)
   {
     return -1;
   }
 
-  unpack_pk(rho, &t1, pk);
-  if (unpack_sig(c, &z, &h, sig))
+  unpack_pk(rho, &w->t1, pk);
+  if (unpack_sig(c, &w->tmp.z, &w->tmp.h, sig))
   {
     return -1;
   }
-  if (polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA))
+  if (polyvecl_chknorm(&w->tmp.z, MLDSA_GAMMA1 - MLDSA_BETA))
   {
     return -1;
   }
@@ -307,65 +978,101 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
     memcpy(mu, m, MLDSA_CRHBYTES);
   }
 
-  /* Matrix-vector multiplication; compute Az - c2^dt1 */
-  poly_challenge(&cp, c);
-  polyvec_matrix_expand(mat, rho);
+  polyvec_matrix_expand(&w->mat, rho);
+  polyveck_shiftl(&w->t1);
+  polyveck_ntt(&w->t1);
 
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  return mld_verify_challenge(c, mu, &w->mat, &w->t1, &w->tmp);
+}
 
-  poly_ntt(&cp);
-  polyveck_shiftl(&t1);
-  polyveck_ntt(&t1);
-  polyveck_pointwise_poly_montgomery(&t1, &cp, &t1);
+int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *pre, size_t prelen,
+                                const uint8_t *pk, int externalmu)
+{
+  mld_verify_ws ws;
+  return crypto_sign_verify_internal_ws(sig, siglen, m, mlen, pre, prelen, pk,
+                                        externalmu, &ws);
+}
 
-  polyveck_sub(&w1, &w1, &t1);
-  polyveck_reduce(&w1);
-  polyveck_invntt_tomont(&w1);
+int crypto_sign_expand_pk(mld_expanded_pk *epk, const uint8_t *pk)
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
 
-  /* Reconstruct w1 */
-  polyveck_caddq(&w1);
-  polyveck_use_hint(&w1, &w1, &h);
-  polyveck_pack_w1(buf, &w1);
+  unpack_pk(rho, &epk->t1, pk);
+  shake256(epk->tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
 
-  /* Call random oracle and verify challenge */
-  shake256_init(&state);
-  shake256_absorb(&state, mu, MLDSA_CRHBYTES);
-  shake256_absorb(&state, buf, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
-  shake256_finalize(&state);
-  shake256_squeeze(c2, MLDSA_CTILDEBYTES, &state);
-  for (i = 0; i < MLDSA_CTILDEBYTES; ++i)
+  polyvec_matrix_expand(&epk->mat, rho);
+  polyveck_shiftl(&epk->t1);
+  polyveck_ntt(&epk->t1);
+  return 0;
+}
+
+int crypto_sign_verify_expanded_internal(const uint8_t *sig, size_t siglen,
+                                         const uint8_t *m, size_t mlen,
+                                         const uint8_t *pre, size_t prelen,
+                                         const mld_expanded_pk *epk,
+                                         int externalmu)
+{
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t c[MLDSA_CTILDEBYTES];
+  keccak_state state;
+  mld_verify_scratch tmp;
+
+  if (siglen != CRYPTO_BYTES)
   {
-    if (c[i] != c2[i])
-    {
-      return -1;
-    }
+    return -1;
   }
 
-  return 0;
+  if (unpack_sig(c, &tmp.z, &tmp.h, sig))
+  {
+    return -1;
+  }
+  if (polyvecl_chknorm(&tmp.z, MLDSA_GAMMA1 - MLDSA_BETA))
+  {
+    return -1;
+  }
+
+  if (!externalmu)
+  {
+    /* Compute CRH(tr, pre, msg) */
+    shake256_init(&state);
+    shake256_absorb(&state, epk->tr, MLDSA_TRBYTES);
+    shake256_absorb(&state, pre, prelen);
+    shake256_absorb(&state, m, mlen);
+    shake256_finalize(&state);
+    shake256_squeeze(mu, MLDSA_CRHBYTES, &state);
+  }
+  else
+  {
+    /* mu has been provided directly */
+    memcpy(mu, m, MLDSA_CRHBYTES);
+  }
+
+  return mld_verify_challenge(c, mu, &epk->mat, &epk->t1, &tmp);
 }
 
 int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                        size_t mlen, const uint8_t *ctx, size_t ctxlen,
                        const uint8_t *pk)
 {
-  size_t i;
+  mld_verify_ws ws;
+  return crypto_sign_verify_ws(sig, siglen, m, mlen, ctx, ctxlen, pk, &ws);
+}
+
+int crypto_sign_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                          const uint8_t *pk, void *ws)
+{
   uint8_t pre[257];
 
-  if (ctxlen > 255)
+  if (mld_prepare_pre(pre, ctx, ctxlen) != 0)
   {
     return -1;
   }
 
-  pre[0] = 0;
-  pre[1] = ctxlen;
-  for (i = 0; i < ctxlen; i++)
-  {
-    pre[2 + i] = ctx[i];
-  }
-
-  return crypto_sign_verify_internal(sig, siglen, m, mlen, pre, 2 + ctxlen, pk,
-                                     0);
+  return crypto_sign_verify_internal_ws(sig, siglen, m, mlen, pre, 2 + ctxlen,
+                                        pk, 0, ws);
 }
 
 int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
@@ -375,6 +1082,151 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
   return crypto_sign_verify_internal(sig, siglen, mu, 0, NULL, 0, pk, 1);
 }
 
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const mld_expanded_pk *epk)
+{
+  uint8_t pre[257];
+
+  if (mld_prepare_pre(pre, ctx, ctxlen) != 0)
+  {
+    return -1;
+  }
+
+  return crypto_sign_verify_expanded_internal(sig, siglen, m, mlen, pre,
+                                              2 + ctxlen, epk, 0);
+}
+
+/*************************************************
+ * Name:        mld_verify_batch_x4
+ *
+ * Description: Verifies up to four signatures under one expanded public
+ *              key. Computing mu and w1 is done one signature at a time;
+ *              sampling the challenge polynomials and the final hash of
+ *              mu || w1 are done with 4-way batched SHAKE256. Unused or
+ *              rejected lanes hash dummy inputs.
+ *
+ * Arguments:   - int *ret: output, 0 or -1 for each of the n signatures
+ *              - size_t n: number of signatures, 1 <= n <= 4
+ *              - other arguments as for crypto_sign_verify_batch_expanded()
+ **************************************************/
+static void mld_verify_batch_x4(int *ret, const uint8_t *const *sig,
+                                const size_t *siglen, const uint8_t *const *m,
+                                const size_t *mlen, const uint8_t *const *ctx,
+                                const size_t *ctxlen, size_t n,
+                                const mld_expanded_pk *epk)
+{
+  unsigned int k, i;
+  int ok[4];
+  uint8_t c[4][MLDSA_CTILDEBYTES];
+  uint8_t pre[2];
+  MLD_ALIGN uint8_t buf[4][MLD_ALIGN_UP(MLD_W1_HASHBYTES)];
+  MLD_ALIGN uint8_t c2[4][MLD_ALIGN_UP(SHAKE256_RATE)];
+  poly cp[4];
+  mld_verify_scratch tmp;
+  keccak_state state;
+  keccakx4_state statex4;
+
+  /* Check the lengths, and compute mu = CRH(tr, pre, msg) into the start
+   * of buf[k]. The challenge seed c is the first part of the signature and
+   * can be read before unpacking the rest. */
+  for (k = 0; k < 4; k++)
+  {
+    ok[k] = -1;
+    if (k >= n || siglen[k] != CRYPTO_BYTES || ctxlen[k] > 255)
+    {
+      memset(c[k], 0, MLDSA_CTILDEBYTES);
+      memset(buf[k], 0, MLD_W1_HASHBYTES);
+      continue;
+    }
+    ok[k] = 0;
+    memcpy(c[k], sig[k], MLDSA_CTILDEBYTES);
+
+    pre[0] = 0;
+    pre[1] = (uint8_t)ctxlen[k];
+    shake256_init(&state);
+    shake256_absorb(&state, epk->tr, MLDSA_TRBYTES);
+    shake256_absorb(&state, pre, 2);
+    shake256_absorb(&state, ctx[k], ctxlen[k]);
+    shake256_absorb(&state, m[k], mlen[k]);
+    shake256_finalize(&state);
+    shake256_squeeze(buf[k], MLDSA_CRHBYTES, &state);
+  }
+
+  poly_challenge_4x(&cp[0], &cp[1], &cp[2], &cp[3], c[0], c[1], c[2], c[3]);
+
+  /* Unpack and check the rest of the signature, and reconstruct w1 into
+   * buf[k] after mu. Only one response and hint are held at a time. */
+  for (k = 0; k < n; k++)
+  {
+    if (ok[k] != 0 || unpack_sig(c[k], &tmp.z, &tmp.h, sig[k]) ||
+        polyvecl_chknorm(&tmp.z, MLDSA_GAMMA1 - MLDSA_BETA))
+    {
+      /* The lane is still hashed below; do not leave w1 uninitialized */
+      ok[k] = -1;
+      memset(buf[k] + MLDSA_CRHBYTES, 0, MLD_W1_HASHBYTES - MLDSA_CRHBYTES);
+      continue;
+    }
+    tmp.cp = cp[k];
+    mld_verify_w1(buf[k] + MLDSA_CRHBYTES, &epk->mat, &epk->t1, &tmp);
+  }
+
+  shake256x4_absorb_once(&statex4, buf[0], buf[1], buf[2], buf[3],
+                         MLD_W1_HASHBYTES);
+  shake256x4_squeezeblocks(c2[0], c2[1], c2[2], c2[3], 1, &statex4);
+
+  for (k = 0; k < n; k++)
+  {
+    for (i = 0; i < MLDSA_CTILDEBYTES; ++i)
+    {
+      if (c[k][i] != c2[k][i])
+      {
+        ok[k] = -1;
+      }
+    }
+    ret[k] = ok[k];
+  }
+}
+
+int crypto_sign_verify_batch_expanded(int *ret, const uint8_t *const *sig,
+                                      const size_t *siglen,
+                                      const uint8_t *const *m,
+                                      const size_t *mlen,
+                                      const uint8_t *const *ctx,
+                                      const size_t *ctxlen, size_t n,
+                                      const mld_expanded_pk *epk)
+{
+  size_t i, len;
+  int res = 0;
+
+  for (i = 0; i < n; i += len)
+  {
+    len = n - i < 4 ? n - i : 4;
+    mld_verify_batch_x4(ret + i, sig + i, siglen + i, m + i, mlen + i,
+                        ctx + i, ctxlen + i, len, epk);
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    res |= ret[i];
+  }
+  return res;
+}
+
+int crypto_sign_verify_batch(int *ret, const uint8_t *const *sig,
+                             const size_t *siglen, const uint8_t *const *m,
+                             const size_t *mlen, const uint8_t *const *ctx,
+                             const size_t *ctxlen, size_t n,
+                             const uint8_t *pk)
+{
+  mld_expanded_pk epk;
+
+  crypto_sign_expand_pk(&epk, pk);
+  return crypto_sign_verify_batch_expanded(ret, sig, siglen, m, mlen, ctx,
+                                           ctxlen, n, &epk);
+}
+
 int crypto_sign_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                      const uint8_t *ctx, size_t ctxlen, const uint8_t *pk)
 {
@@ -411,3 +1263,92 @@ badsig:
 
   return -1;
 }
+
+/*************************************************
+ * Name:        mld_message_init
+ *
+ * Description: Starts the computation of mu = CRH(tr, pre, msg) with
+ *              pre = (0, ctxlen, ctx), leaving the message to be absorbed.
+ *
+ * Arguments:   - mld_message_state *st: pointer to output state
+ *              - const uint8_t *tr: public key hash
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+static int mld_message_init(mld_message_state *st,
+                            const uint8_t tr[MLDSA_TRBYTES],
+                            const uint8_t *ctx, size_t ctxlen)
+{
+  uint8_t pre[2];
+
+  if (ctxlen > 255)
+  {
+    return -1;
+  }
+
+  pre[0] = 0;
+  pre[1] = (uint8_t)ctxlen;
+
+  shake256_init(&st->state);
+  shake256_absorb(&st->state, tr, MLDSA_TRBYTES);
+  shake256_absorb(&st->state, pre, 2);
+  shake256_absorb(&st->state, ctx, ctxlen);
+  return 0;
+}
+
+int crypto_sign_signature_init(mld_message_state *st, const uint8_t *ctx,
+                               size_t ctxlen, const uint8_t *sk)
+{
+  /* tr follows rho and key in the packed secret key, see pack_sk() */
+  return mld_message_init(st, sk + 2 * MLDSA_SEEDBYTES, ctx, ctxlen);
+}
+
+void crypto_sign_signature_update(mld_message_state *st, const uint8_t *m,
+                                  size_t mlen)
+{
+  shake256_absorb(&st->state, m, mlen);
+}
+
+int crypto_sign_signature_final(mld_message_state *st, uint8_t *sig,
+                                size_t *siglen, const uint8_t *sk)
+{
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  shake256_finalize(&st->state);
+  shake256_squeeze(mu, MLDSA_CRHBYTES, &st->state);
+
+  mld_prepare_rnd(rnd);
+
+  return crypto_sign_signature_internal(sig, siglen, mu, MLDSA_CRHBYTES, NULL,
+                                        0, rnd, sk, 1);
+}
+
+int crypto_sign_verify_init(mld_message_state *st, const uint8_t *ctx,
+                            size_t ctxlen, const uint8_t *pk)
+{
+  uint8_t tr[MLDSA_TRBYTES];
+
+  shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  return mld_message_init(st, tr, ctx, ctxlen);
+}
+
+void crypto_sign_verify_update(mld_message_state *st, const uint8_t *m,
+                               size_t mlen)
+{
+  shake256_absorb(&st->state, m, mlen);
+}
+
+int crypto_sign_verify_final(mld_message_state *st, const uint8_t *sig,
+                             size_t siglen, const uint8_t *pk)
+{
+  uint8_t mu[MLDSA_CRHBYTES];
+
+  shake256_finalize(&st->state);
+  shake256_squeeze(mu, MLDSA_CRHBYTES, &st->state);
+
+  return crypto_sign_verify_internal(sig, siglen, mu, MLDSA_CRHBYTES, NULL, 0,
+                                     pk, 1);
+}
@@ -8,9 +8,78 @@
 #include <stddef.h>
 #include <stdint.h>
 #include "common.h"
+#include "fips202/fips202.h"
 #include "poly.h"
 #include "polyvec.h"
 
+/* Without a native inverse NTT, multiplying by the challenge as a sum of
+ * signed rotations (see poly_sparse_mul()) is faster than through the
+ * NTT, and signing keeps s1, s2 and t0 in the normal domain. With the
+ * native backend, the NTT is faster. */
+#if !defined(MLD_USE_NATIVE_INTT)
+#define MLD_SIGN_SPARSE_CHALLENGE
+#endif
+
+/* Secret key in expanded form, for repeated signing with the same key.
+ * Holds the matrix A and the secret vectors s1, s2 and t0 in NTT domain,
+ * or in the normal domain with MLD_SIGN_SPARSE_CHALLENGE, together with
+ * tr and key. With MLD_CONFIG_REDUCE_RAM, A is represented by its seed
+ * only. The contents are internal; the object is filled by
+ * crypto_sign_expand_sk(). */
+typedef struct
+{
+  polymat mat;
+  polyvecl s1;
+  polyveck s2;
+  polyveck t0;
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+} mld_expanded_sk;
+
+/* Public key in expanded form, for repeated verification with the same
+ * key. Holds tr = H(pk), the matrix A and t1 * 2^d in NTT domain. With
+ * MLD_CONFIG_REDUCE_RAM, A is represented by its seed only. The contents
+ * are internal; the object is filled by crypto_sign_expand_pk(). */
+typedef struct
+{
+  polymat mat;
+  polyveck t1;
+  uint8_t tr[MLDSA_TRBYTES];
+} mld_expanded_pk;
+
+/* Temporaries of a signing attempt, see crypto_sign_signature_attempt() */
+typedef struct
+{
+  polyvecl y, z;
+  polyveck w1, w0, h;
+  poly cp;
+#if defined(MLD_SIGN_SPARSE_CHALLENGE)
+  poly_sparse cs;
+#endif
+} mld_sign_scratch;
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+/* Counters of signing attempts and of the reasons they were rejected,
+ * see mld_sign_stats_get(). Every attempt is counted once, and at most
+ * one of the rejection counters is incremented for it. */
+typedef struct
+{
+  uint64_t attempts;
+  uint64_t rejected_z;    /* ||z||_inf >= gamma1 - beta */
+  uint64_t rejected_r0;   /* ||r0||_inf >= gamma2 - beta, r0 = w0 - cs2 */
+  uint64_t rejected_ct0;  /* ||ct0||_inf >= gamma2 */
+  uint64_t rejected_hint; /* more than omega hints */
+} mld_sign_stats;
+#endif /* MLD_CONFIG_SIGN_STATS */
+
+/* State of an incremental computation of the message representative
+ * mu = CRH(tr, pre, msg), for signing or verifying a message supplied in
+ * chunks. See crypto_sign_signature_init() and crypto_sign_verify_init(). */
+typedef struct
+{
+  keccak_state state;
+} mld_message_state;
+
 #define crypto_sign_keypair_internal MLD_NAMESPACE(keypair_internal)
 /*************************************************
  * Name:        crypto_sign_keypair_internal
@@ -112,6 +181,280 @@ int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
                                 const uint8_t mu[MLDSA_CRHBYTES],
                                 const uint8_t *sk);
 
+#define crypto_sign_expand_sk MLD_NAMESPACE(expand_sk)
+/*************************************************
+ * Name:        crypto_sign_expand_sk
+ *
+ * Description: Unpacks a secret key and precomputes everything that
+ *              signing derives from the key alone: the expanded matrix A
+ *              and, unless MLD_SIGN_SPARSE_CHALLENGE is set, the NTTs of
+ *              s1, s2 and t0.
+ *
+ *              The expanded key holds secret data, and should be treated
+ *              like the packed secret key.
+ *
+ * Arguments:   - mld_expanded_sk *esk: pointer to output expanded key
+ *              - const uint8_t *sk:    pointer to bit-packed secret key
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_expand_sk(mld_expanded_sk *esk, const uint8_t *sk);
+
+#define crypto_sign_signature_expanded_internal \
+  MLD_NAMESPACE(signature_expanded_internal)
+/*************************************************
+ * Name:        crypto_sign_signature_expanded_internal
+ *
+ * Description: Computes signature with an expanded secret key.
+ *              Internal API.
+ *
+ *              Same as crypto_sign_signature_internal(), but starts
+ *              directly with the computation of mu and the rejection
+ *              loop. The output is identical.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *pre:   pointer to prefix string
+ *              - size_t prelen:  length of prefix string
+ *              - uint8_t *rnd:   pointer to random seed
+ *              - const mld_expanded_sk *esk: pointer to expanded key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_signature_expanded_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const mld_expanded_sk *esk, int externalmu);
+
+#define crypto_sign_prepare MLD_NAMESPACE(sign_prepare)
+/*************************************************
+ * Name:        crypto_sign_prepare
+ *
+ * Description: Prepares the inputs of crypto_sign_signature_internal()
+ *              and its variants for the pure ML-DSA.Sign: the prefix
+ *              pre = (0, ctxlen, ctx) of 2 + ctxlen bytes, and the
+ *              randomness rnd, which is all zero unless
+ *              MLD_RANDOMIZED_SIGNING is set. Internal API.
+ *
+ * Arguments:   - uint8_t *pre:       output prefix
+ *              - uint8_t *rnd:       output randomness
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen:      length of context string
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_prepare(uint8_t pre[257], uint8_t rnd[MLDSA_RNDBYTES],
+                        const uint8_t *ctx, size_t ctxlen);
+
+#define crypto_sign_signature_seeds MLD_NAMESPACE(signature_seeds)
+/*************************************************
+ * Name:        crypto_sign_signature_seeds
+ *
+ * Description: First part of signing with an expanded secret key.
+ *              Computes the message representative mu and the seed
+ *              rhoprime of the rejection loop. Internal API.
+ *
+ * Arguments:   - uint8_t *mu:       output message representative
+ *              - uint8_t *rhoprime: output seed of the masking vectors
+ *              - other arguments as for
+ *                crypto_sign_signature_expanded_internal()
+ **************************************************/
+void crypto_sign_signature_seeds(uint8_t mu[MLDSA_CRHBYTES],
+                                 uint8_t rhoprime[MLDSA_CRHBYTES],
+                                 const uint8_t *m, size_t mlen,
+                                 const uint8_t *pre, size_t prelen,
+                                 const uint8_t rnd[MLDSA_RNDBYTES],
+                                 const mld_expanded_sk *esk, int externalmu);
+
+#define crypto_sign_signature_attempt MLD_NAMESPACE(signature_attempt)
+/*************************************************
+ * Name:        crypto_sign_signature_attempt
+ *
+ * Description: One iteration of the rejection loop of signing, for the
+ *              masking vector with the given nonce. Internal API.
+ *
+ *              The attempt only depends on its arguments, so attempts
+ *              for different nonces may run concurrently, each with its
+ *              own sig and tmp. Signing returns the accepted attempt with
+ *              the lowest nonce, starting from 0.
+ *
+ * Arguments:   - uint8_t *sig: output signature of length CRYPTO_BYTES;
+ *                              also used as scratch space if rejected
+ *              - const mld_expanded_sk *esk: pointer to expanded key
+ *              - const uint8_t *mu: message representative
+ *              - const uint8_t *rhoprime: seed of the masking vectors
+ *              - uint16_t nonce: index of the attempt
+ *              - mld_sign_scratch *tmp: pointer to temporaries
+ *
+ * Returns 0 if the attempt is accepted and -1 if it is rejected
+ **************************************************/
+int crypto_sign_signature_attempt(uint8_t *sig, const mld_expanded_sk *esk,
+                                  const uint8_t mu[MLDSA_CRHBYTES],
+                                  const uint8_t rhoprime[MLDSA_CRHBYTES],
+                                  uint16_t nonce, mld_sign_scratch *tmp);
+
+#define crypto_sign_signature_expanded MLD_NAMESPACE(signature_expanded)
+/*************************************************
+ * Name:        crypto_sign_signature_expanded
+ *
+ * Description: FIPS 204: Algorithm 2 ML-DSA.Sign, using a secret key
+ *              expanded with crypto_sign_expand_sk().
+ *              Computes signature.
+ *
+ *              The signature is the same as for crypto_sign_signature()
+ *              with the packed secret key.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *ctx:   pointer to context string
+ *              - size_t ctxlen:  length of context string
+ *              - const mld_expanded_sk *esk: pointer to expanded key
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const mld_expanded_sk *esk);
+
+#define crypto_sign_signature_batch MLD_NAMESPACE(signature_batch)
+/*************************************************
+ * Name:        crypto_sign_signature_batch
+ *
+ * Description: FIPS 204: Algorithm 2 ML-DSA.Sign for n messages under the
+ *              same secret key.
+ *
+ *              The secret key is expanded once. Up to four messages are
+ *              signed at a time: mu, rhoprime, the masking vectors y and
+ *              the challenge hash are computed with 4-way batched
+ *              SHAKE256. When an attempt is accepted, its lane continues
+ *              with the next message, so lanes stay busy while messages
+ *              are rejected a different number of times.
+ *
+ *              Randomness is drawn in message order, and every signature
+ *              is the same as the one crypto_sign_signature() computes
+ *              with the same randomness. The signature buffers also hold
+ *              intermediate values until their message is signed.
+ *
+ *              Uses about four times the stack of
+ *              crypto_sign_signature_expanded(); see
+ *              crypto_sign_signature_batch_ws() to provide this memory
+ *              instead.
+ *
+ * Arguments:   - uint8_t *const *sig: array of n output signatures of
+ *                                     length CRYPTO_BYTES
+ *              - size_t *siglen: array of n output signature lengths
+ *              - const uint8_t *const *m: array of n messages
+ *              - const size_t *mlen: array of n message lengths
+ *              - const uint8_t *const *ctx: array of n context strings
+ *              - const size_t *ctxlen: array of n context string lengths
+ *              - size_t n: number of messages
+ *              - const uint8_t *sk: pointer to bit-packed secret key
+ *
+ * Returns 0 (success) or -1 (a context string is too long; no signature
+ * is computed)
+ **************************************************/
+int crypto_sign_signature_batch(uint8_t *const *sig, size_t *siglen,
+                                const uint8_t *const *m, const size_t *mlen,
+                                const uint8_t *const *ctx,
+                                const size_t *ctxlen, size_t n,
+                                const uint8_t *sk);
+
+#define crypto_sign_signature_batch_expanded \
+  MLD_NAMESPACE(signature_batch_expanded)
+/*************************************************
+ * Name:        crypto_sign_signature_batch_expanded
+ *
+ * Description: Same as crypto_sign_signature_batch(), using a secret key
+ *              expanded with crypto_sign_expand_sk().
+ *
+ * Arguments:   - const mld_expanded_sk *esk: pointer to expanded key
+ *              - other arguments as for crypto_sign_signature_batch()
+ *
+ * Returns 0 (success) or -1 (a context string is too long)
+ **************************************************/
+int crypto_sign_signature_batch_expanded(
+    uint8_t *const *sig, size_t *siglen, const uint8_t *const *m,
+    const size_t *mlen, const uint8_t *const *ctx, const size_t *ctxlen,
+    size_t n, const mld_expanded_sk *esk);
+
+#define crypto_sign_batch_workspace_size MLD_NAMESPACE(batch_workspace_size)
+/*************************************************
+ * Name:        crypto_sign_batch_workspace_size
+ *
+ * Description: Returns the size in bytes of the workspace expected by
+ *              crypto_sign_signature_batch_ws() and
+ *              crypto_sign_signature_batch_expanded_ws() for this
+ *              parameter set.
+ *
+ *              The same rules apply as for crypto_sign_workspace_size():
+ *              the workspace must be aligned to MLD_DEFAULT_ALIGN bytes,
+ *              may be reused, but only by one call at a time, and holds
+ *              secret data after signing.
+ *
+ * Returns the workspace size, a multiple of MLD_DEFAULT_ALIGN
+ **************************************************/
+size_t crypto_sign_batch_workspace_size(void);
+
+#define crypto_sign_signature_batch_ws MLD_NAMESPACE(signature_batch_ws)
+/*************************************************
+ * Name:        crypto_sign_signature_batch_ws
+ *
+ * Description: Same as crypto_sign_signature_batch(), using the
+ *              caller-provided workspace ws of
+ *              crypto_sign_batch_workspace_size() bytes.
+ **************************************************/
+int crypto_sign_signature_batch_ws(uint8_t *const *sig, size_t *siglen,
+                                   const uint8_t *const *m,
+                                   const size_t *mlen,
+                                   const uint8_t *const *ctx,
+                                   const size_t *ctxlen, size_t n,
+                                   const uint8_t *sk, void *ws);
+
+#define crypto_sign_signature_batch_expanded_ws \
+  MLD_NAMESPACE(signature_batch_expanded_ws)
+/*************************************************
+ * Name:        crypto_sign_signature_batch_expanded_ws
+ *
+ * Description: Same as crypto_sign_signature_batch_expanded(), using the
+ *              caller-provided workspace ws of
+ *              crypto_sign_batch_workspace_size() bytes.
+ **************************************************/
+int crypto_sign_signature_batch_expanded_ws(
+    uint8_t *const *sig, size_t *siglen, const uint8_t *const *m,
+    const size_t *mlen, const uint8_t *const *ctx, const size_t *ctxlen,
+    size_t n, const mld_expanded_sk *esk, void *ws);
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+#define mld_sign_stats_get MLD_NAMESPACE(sign_stats_get)
+/*************************************************
+ * Name:        mld_sign_stats_get
+ *
+ * Description: Returns the signing statistics of the calling thread,
+ *              accumulated since the thread started or since the last
+ *              call to mld_sign_stats_reset(). Attempts run by the threads
+ *              of a signing pool are counted in those threads.
+ *
+ * Arguments:   - mld_sign_stats *stats: pointer to output counters
+ **************************************************/
+void mld_sign_stats_get(mld_sign_stats *stats);
+
+#define mld_sign_stats_reset MLD_NAMESPACE(sign_stats_reset)
+/*************************************************
+ * Name:        mld_sign_stats_reset
+ *
+ * Description: Clears the signing statistics of the calling thread.
+ **************************************************/
+void mld_sign_stats_reset(void);
+#endif /* MLD_CONFIG_SIGN_STATS */
+
 #define crypto_sign MLD_NAMESPACETOP
 /*************************************************
  * Name:        crypto_sign
@@ -195,6 +538,128 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
                              const uint8_t mu[MLDSA_CRHBYTES],
                              const uint8_t *pk);
 
+#define crypto_sign_expand_pk MLD_NAMESPACE(expand_pk)
+/*************************************************
+ * Name:        crypto_sign_expand_pk
+ *
+ * Description: Unpacks a public key and precomputes everything that
+ *              verification derives from the key alone: tr = H(pk), the
+ *              expanded matrix A and the NTT of t1 * 2^d.
+ *
+ * Arguments:   - mld_expanded_pk *epk: pointer to output expanded key
+ *              - const uint8_t *pk:    pointer to bit-packed public key
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_expand_pk(mld_expanded_pk *epk, const uint8_t *pk);
+
+#define crypto_sign_verify_expanded_internal \
+  MLD_NAMESPACE(verify_expanded_internal)
+/*************************************************
+ * Name:        crypto_sign_verify_expanded_internal
+ *
+ * Description: Verifies signature with an expanded public key.
+ *              Internal API.
+ *
+ *              Same as crypto_sign_verify_internal(), but only the
+ *              signature-dependent work is done per call: the NTT of z,
+ *              the pointwise products and the hashing.
+ *
+ * Arguments:   - uint8_t *sig: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *m: pointer to message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *pre: pointer to prefix string
+ *              - size_t prelen: length of prefix string
+ *              - const mld_expanded_pk *epk: pointer to expanded key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_expanded_internal(const uint8_t *sig, size_t siglen,
+                                         const uint8_t *m, size_t mlen,
+                                         const uint8_t *pre, size_t prelen,
+                                         const mld_expanded_pk *epk,
+                                         int externalmu);
+
+#define crypto_sign_verify_expanded MLD_NAMESPACE(verify_expanded)
+/*************************************************
+ * Name:        crypto_sign_verify_expanded
+ *
+ * Description: FIPS 204: Algorithm 3 ML-DSA.Verify, using a public key
+ *              expanded with crypto_sign_expand_pk().
+ *              Verifies signature.
+ *
+ * Arguments:   - uint8_t *sig: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *m: pointer to message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const mld_expanded_pk *epk: pointer to expanded key
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const mld_expanded_pk *epk);
+
+#define crypto_sign_verify_batch MLD_NAMESPACE(verify_batch)
+/*************************************************
+ * Name:        crypto_sign_verify_batch
+ *
+ * Description: FIPS 204: Algorithm 3 ML-DSA.Verify for n signatures
+ *              under the same public key.
+ *
+ *              The public key is expanded once. The signatures are then
+ *              processed in groups of four, sampling the challenges and
+ *              computing the final hashes with 4-way batched SHAKE256.
+ *              The result for every signature is the same as for
+ *              crypto_sign_verify().
+ *
+ * Arguments:   - int *ret: output array of n results, 0 if the i-th
+ *                          signature could be verified correctly and -1
+ *                          otherwise
+ *              - const uint8_t *const *sig: array of n signatures
+ *              - const size_t *siglen: array of n signature lengths
+ *              - const uint8_t *const *m: array of n messages
+ *              - const size_t *mlen: array of n message lengths
+ *              - const uint8_t *const *ctx: array of n context strings
+ *              - const size_t *ctxlen: array of n context string lengths
+ *              - size_t n: number of signatures
+ *              - const uint8_t *pk: pointer to bit-packed public key
+ *
+ * Returns 0 if all signatures could be verified correctly and -1
+ * otherwise
+ **************************************************/
+int crypto_sign_verify_batch(int *ret, const uint8_t *const *sig,
+                             const size_t *siglen, const uint8_t *const *m,
+                             const size_t *mlen, const uint8_t *const *ctx,
+                             const size_t *ctxlen, size_t n,
+                             const uint8_t *pk);
+
+#define crypto_sign_verify_batch_expanded MLD_NAMESPACE(verify_batch_expanded)
+/*************************************************
+ * Name:        crypto_sign_verify_batch_expanded
+ *
+ * Description: Same as crypto_sign_verify_batch(), using a public key
+ *              expanded with crypto_sign_expand_pk().
+ *
+ * Arguments:   - const mld_expanded_pk *epk: pointer to expanded key
+ *              - other arguments as for crypto_sign_verify_batch()
+ *
+ * Returns 0 if all signatures could be verified correctly and -1
+ * otherwise
+ **************************************************/
+int crypto_sign_verify_batch_expanded(int *ret, const uint8_t *const *sig,
+                                      const size_t *siglen,
+                                      const uint8_t *const *m,
+                                      const size_t *mlen,
+                                      const uint8_t *const *ctx,
+                                      const size_t *ctxlen, size_t n,
+                                      const mld_expanded_pk *epk);
+
 #define crypto_sign_open MLD_NAMESPACE(open)
 /*************************************************
  * Name:        crypto_sign_open
@@ -215,4 +680,204 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
 int crypto_sign_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                      const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+#define crypto_sign_signature_init MLD_NAMESPACE(signature_init)
+/*************************************************
+ * Name:        crypto_sign_signature_init
+ *
+ * Description: Starts signing a message that is supplied incrementally
+ *              through crypto_sign_signature_update().
+ *
+ *              Absorbs tr from the secret key and the context string.
+ *              Together with the following functions, this computes the
+ *              same signature as crypto_sign_signature() on the
+ *              concatenation of all message chunks.
+ *
+ * Arguments:   - mld_message_state *st: pointer to output state
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const uint8_t *sk: pointer to bit-packed secret key
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_signature_init(mld_message_state *st, const uint8_t *ctx,
+                               size_t ctxlen, const uint8_t *sk);
+
+#define crypto_sign_signature_update MLD_NAMESPACE(signature_update)
+/*************************************************
+ * Name:        crypto_sign_signature_update
+ *
+ * Description: Absorbs the next chunk of the message to be signed.
+ *
+ * Arguments:   - mld_message_state *st: pointer to state
+ *              - const uint8_t *m: pointer to message chunk
+ *              - size_t mlen: length of message chunk
+ **************************************************/
+void crypto_sign_signature_update(mld_message_state *st, const uint8_t *m,
+                                  size_t mlen);
+
+#define crypto_sign_signature_final MLD_NAMESPACE(signature_final)
+/*************************************************
+ * Name:        crypto_sign_signature_final
+ *
+ * Description: Finishes the computation of mu and computes the signature
+ *              through the external mu path.
+ *
+ * Arguments:   - mld_message_state *st: pointer to state
+ *              - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - const uint8_t *sk: pointer to bit-packed secret key; must
+ *                                be the key passed to
+ *                                crypto_sign_signature_init()
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_signature_final(mld_message_state *st, uint8_t *sig,
+                                size_t *siglen, const uint8_t *sk);
+
+#define crypto_sign_verify_init MLD_NAMESPACE(verify_init)
+/*************************************************
+ * Name:        crypto_sign_verify_init
+ *
+ * Description: Starts verifying a signature on a message that is supplied
+ *              incrementally through crypto_sign_verify_update().
+ *
+ *              Absorbs tr = H(pk) and the context string. Together with
+ *              the following functions, this gives the same result as
+ *              crypto_sign_verify() on the concatenation of all message
+ *              chunks.
+ *
+ * Arguments:   - mld_message_state *st: pointer to output state
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const uint8_t *pk: pointer to bit-packed public key
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_verify_init(mld_message_state *st, const uint8_t *ctx,
+                            size_t ctxlen, const uint8_t *pk);
+
+#define crypto_sign_verify_update MLD_NAMESPACE(verify_update)
+/*************************************************
+ * Name:        crypto_sign_verify_update
+ *
+ * Description: Absorbs the next chunk of the message to be verified.
+ *
+ * Arguments:   - mld_message_state *st: pointer to state
+ *              - const uint8_t *m: pointer to message chunk
+ *              - size_t mlen: length of message chunk
+ **************************************************/
+void crypto_sign_verify_update(mld_message_state *st, const uint8_t *m,
+                               size_t mlen);
+
+#define crypto_sign_verify_final MLD_NAMESPACE(verify_final)
+/*************************************************
+ * Name:        crypto_sign_verify_final
+ *
+ * Description: Finishes the computation of mu and verifies the signature
+ *              through the external mu path.
+ *
+ * Arguments:   - mld_message_state *st: pointer to state
+ *              - const uint8_t *sig: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *pk: pointer to bit-packed public key; must
+ *                                be the key passed to
+ *                                crypto_sign_verify_init()
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_final(mld_message_state *st, const uint8_t *sig,
+                             size_t siglen, const uint8_t *pk);
+
+#define crypto_sign_workspace_size MLD_NAMESPACE(workspace_size)
+/*************************************************
+ * Name:        crypto_sign_workspace_size
+ *
+ * Description: Returns the size in bytes of the workspace expected by
+ *              the *_ws variants of key generation, signing and
+ *              verification for this parameter set.
+ *
+ *              A workspace must be aligned to MLD_DEFAULT_ALIGN bytes.
+ *              It holds the large temporaries of the computation, which
+ *              are otherwise placed on the stack, and may be reused for
+ *              any number of calls, but only by one call at a time. It
+ *              holds secret data after key generation and signing.
+ *
+ * Returns the workspace size, a multiple of MLD_DEFAULT_ALIGN
+ **************************************************/
+size_t crypto_sign_workspace_size(void);
+
+#define crypto_sign_keypair_internal_ws MLD_NAMESPACE(keypair_internal_ws)
+/*************************************************
+ * Name:        crypto_sign_keypair_internal_ws
+ *
+ * Description: Same as crypto_sign_keypair_internal(), using the
+ *              caller-provided workspace ws of crypto_sign_workspace_size()
+ *              bytes.
+ **************************************************/
+int crypto_sign_keypair_internal_ws(uint8_t *pk, uint8_t *sk,
+                                    const uint8_t seed[MLDSA_SEEDBYTES],
+                                    void *ws);
+
+#define crypto_sign_keypair_ws MLD_NAMESPACE(keypair_ws)
+/*************************************************
+ * Name:        crypto_sign_keypair_ws
+ *
+ * Description: Same as crypto_sign_keypair(), using the caller-provided
+ *              workspace ws of crypto_sign_workspace_size() bytes.
+ **************************************************/
+int crypto_sign_keypair_ws(uint8_t *pk, uint8_t *sk, void *ws);
+
+#define crypto_sign_signature_internal_ws \
+  MLD_NAMESPACE(signature_internal_ws)
+/*************************************************
+ * Name:        crypto_sign_signature_internal_ws
+ *
+ * Description: Same as crypto_sign_signature_internal(), using the
+ *              caller-provided workspace ws of crypto_sign_workspace_size()
+ *              bytes.
+ **************************************************/
+int crypto_sign_signature_internal_ws(uint8_t *sig, size_t *siglen,
+                                      const uint8_t *m, size_t mlen,
+                                      const uint8_t *pre, size_t prelen,
+                                      const uint8_t rnd[MLDSA_RNDBYTES],
+                                      const uint8_t *sk, int externalmu,
+                                      void *ws);
+
+#define crypto_sign_signature_ws MLD_NAMESPACE(signature_ws)
+/*************************************************
+ * Name:        crypto_sign_signature_ws
+ *
+ * Description: Same as crypto_sign_signature(), using the caller-provided
+ *              workspace ws of crypto_sign_workspace_size() bytes.
+ **************************************************/
+int crypto_sign_signature_ws(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                             size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *sk, void *ws);
+
+#define crypto_sign_verify_internal_ws MLD_NAMESPACE(verify_internal_ws)
+/*************************************************
+ * Name:        crypto_sign_verify_internal_ws
+ *
+ * Description: Same as crypto_sign_verify_internal(), using the
+ *              caller-provided workspace ws of crypto_sign_workspace_size()
+ *              bytes.
+ **************************************************/
+int crypto_sign_verify_internal_ws(const uint8_t *sig, size_t siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *pre, size_t prelen,
+                                   const uint8_t *pk, int externalmu,
+                                   void *ws);
+
+#define crypto_sign_verify_ws MLD_NAMESPACE(verify_ws)
+/*************************************************
+ * Name:        crypto_sign_verify_ws
+ *
+ * Description: Same as crypto_sign_verify(), using the caller-provided
+ *              workspace ws of crypto_sign_workspace_size() bytes.
+ **************************************************/
+int crypto_sign_verify_ws(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                          const uint8_t *pk, void *ws);
+
 #endif /* !MLD_SIGN_H */
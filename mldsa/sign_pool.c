@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "sign_pool.h"
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Per-thread state. Rejected attempts leave partial data in sig, so every
+ * thread signs into its own buffer. */
+typedef struct
+{
+  mld_sign_pool *pool;
+  uint8_t sig[CRYPTO_BYTES];
+  mld_sign_scratch tmp;
+} mld_sign_pool_worker;
+
+struct mld_sign_pool
+{
+  unsigned nthreads; /* number of running threads, including the caller */
+  pthread_t *threads;
+  mld_sign_pool_worker *workers;
+
+  /* Secret key expanded by mld_sign_pool_signature() */
+  mld_expanded_sk esk_buf;
+
+  pthread_mutex_t lock;
+  pthread_cond_t start, done;
+  unsigned long generation;
+  unsigned running;
+  int shutdown;
+
+  /* Current signature. next is the lowest nonce not handed out yet, and
+   * best the lowest accepted nonce so far, or MLD_SIGN_POOL_NONE. */
+  const mld_expanded_sk *esk;
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  unsigned long next, best;
+  uint8_t *sig;
+};
+
+#define MLD_SIGN_POOL_NONE ((unsigned long)-1)
+
+/*************************************************
+ * Name:        mld_sign_pool_work
+ *
+ * Description: Runs attempts of the current signature on thread id until
+ *              no nonce below the lowest accepted one is left.
+ *
+ *              Nonces are handed out in increasing order, so once nonce n
+ *              is accepted, every lower nonce has already been taken by
+ *              some thread and its result will be known when all threads
+ *              have returned.
+ **************************************************/
+static void mld_sign_pool_work(mld_sign_pool *pool, unsigned id)
+{
+  unsigned long n;
+  mld_sign_pool_worker *w = &pool->workers[id];
+
+  for (;;)
+  {
+    pthread_mutex_lock(&pool->lock);
+    n = pool->next;
+    if (n >= pool->best)
+    {
+      pthread_mutex_unlock(&pool->lock);
+      return;
+    }
+    pool->next++;
+    pthread_mutex_unlock(&pool->lock);
+
+    /* The nonce wraps around like the sequential loop */
+    if (crypto_sign_signature_attempt(w->sig, pool->esk, pool->mu,
+                                      pool->rhoprime, (uint16_t)n,
+                                      &w->tmp) == 0)
+    {
+      pthread_mutex_lock(&pool->lock);
+      if (n < pool->best)
+      {
+        pool->best = n;
+        memcpy(pool->sig, w->sig, CRYPTO_BYTES);
+      }
+      pthread_mutex_unlock(&pool->lock);
+    }
+  }
+}
+
+static void *mld_sign_pool_thread(void *arg)
+{
+  mld_sign_pool_worker *w = (mld_sign_pool_worker *)arg;
+  mld_sign_pool *pool = w->pool;
+  unsigned id = (unsigned)(w - pool->workers);
+  unsigned long seen = 0;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->generation == seen && !pool->shutdown)
+    {
+      pthread_cond_wait(&pool->start, &pool->lock);
+    }
+    if (pool->shutdown)
+    {
+      pthread_mutex_unlock(&pool->lock);
+      return NULL;
+    }
+    seen = pool->generation;
+    pthread_mutex_unlock(&pool->lock);
+
+    mld_sign_pool_work(pool, id);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0)
+    {
+      pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+mld_sign_pool *mld_sign_pool_create(unsigned nthreads)
+{
+  unsigned int i;
+  mld_sign_pool *pool;
+
+  if (nthreads == 0)
+  {
+    return NULL;
+  }
+
+  pool = (mld_sign_pool *)calloc(1, sizeof(mld_sign_pool));
+  if (pool == NULL)
+  {
+    return NULL;
+  }
+  pool->workers =
+      (mld_sign_pool_worker *)calloc(nthreads, sizeof(mld_sign_pool_worker));
+  pool->threads = (pthread_t *)calloc(nthreads, sizeof(pthread_t));
+  if (pool->workers == NULL || pool->threads == NULL)
+  {
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+    return NULL;
+  }
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  for (i = 0; i < nthreads; i++)
+  {
+    pool->workers[i].pool = pool;
+  }
+
+  /* Thread 0 is the caller of mld_sign_pool_signature() */
+  pool->nthreads = 1;
+  for (i = 1; i < nthreads; i++)
+  {
+    if (pthread_create(&pool->threads[i], NULL, mld_sign_pool_thread,
+                       &pool->workers[i]) != 0)
+    {
+      mld_sign_pool_destroy(pool);
+      return NULL;
+    }
+    pool->nthreads++;
+  }
+  return pool;
+}
+
+void mld_sign_pool_destroy(mld_sign_pool *pool)
+{
+  unsigned int i;
+
+  if (pool == NULL)
+  {
+    return;
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = 1;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  for (i = 1; i < pool->nthreads; i++)
+  {
+    pthread_join(pool->threads[i], NULL);
+  }
+
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->start);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->threads);
+  free(pool->workers);
+  free(pool);
+}
+
+int mld_sign_pool_signature_expanded(mld_sign_pool *pool, uint8_t *sig,
+                                     size_t *siglen, const uint8_t *m,
+                                     size_t mlen, const uint8_t *ctx,
+                                     size_t ctxlen, const mld_expanded_sk *esk)
+{
+  uint8_t pre[257];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (crypto_sign_prepare(pre, rnd, ctx, ctxlen) != 0)
+  {
+    return -1;
+  }
+
+  crypto_sign_signature_seeds(pool->mu, pool->rhoprime, m, mlen, pre,
+                              2 + ctxlen, rnd, esk, 0);
+
+  /* Start at nonce 0 and wake up the workers */
+  pthread_mutex_lock(&pool->lock);
+  pool->esk = esk;
+  pool->sig = sig;
+  pool->next = 0;
+  pool->best = MLD_SIGN_POOL_NONE;
+  pool->running = pool->nthreads - 1;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  mld_sign_pool_work(pool, 0);
+
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running > 0)
+  {
+    pthread_cond_wait(&pool->done, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  *siglen = CRYPTO_BYTES;
+  return 0;
+}
+
+int mld_sign_pool_signature(mld_sign_pool *pool, uint8_t *sig, size_t *siglen,
+                            const uint8_t *m, size_t mlen, const uint8_t *ctx,
+                            size_t ctxlen, const uint8_t *sk)
+{
+  crypto_sign_expand_sk(&pool->esk_buf, sk);
+  return mld_sign_pool_signature_expanded(pool, sig, siglen, m, mlen, ctx,
+                                          ctxlen, &pool->esk_buf);
+}
+
+#else /* MLD_CONFIG_USE_PTHREADS */
+
+MLD_EMPTY_CU(sign_pool)
+
+#endif /* !MLD_CONFIG_USE_PTHREADS */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_SIGN_POOL_H
+#define MLD_SIGN_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+#include "sign.h"
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+
+/* Opaque signing pool, see mld_sign_pool_create() */
+typedef struct mld_sign_pool mld_sign_pool;
+
+#define mld_sign_pool_create MLD_NAMESPACE(sign_pool_create)
+/*************************************************
+ * Name:        mld_sign_pool_create
+ *
+ * Description: Creates a pool of nthreads - 1 worker threads which,
+ *              together with the calling thread, run the attempts of the
+ *              rejection loop of a single signature in parallel.
+ *
+ *              The workers are started once and sleep between signatures.
+ *
+ * Arguments:   - unsigned nthreads: number of threads, at least 1
+ *
+ * Returns pointer to the pool, or NULL if allocation or thread creation
+ * failed
+ **************************************************/
+mld_sign_pool *mld_sign_pool_create(unsigned nthreads);
+
+#define mld_sign_pool_destroy MLD_NAMESPACE(sign_pool_destroy)
+/*************************************************
+ * Name:        mld_sign_pool_destroy
+ *
+ * Description: Stops the worker threads and frees the pool.
+ *
+ * Arguments:   - mld_sign_pool *pool: pointer to pool, or NULL
+ **************************************************/
+void mld_sign_pool_destroy(mld_sign_pool *pool);
+
+#define mld_sign_pool_signature_expanded \
+  MLD_NAMESPACE(sign_pool_signature_expanded)
+/*************************************************
+ * Name:        mld_sign_pool_signature_expanded
+ *
+ * Description: Computes signature with an expanded secret key, using all
+ *              threads of the pool.
+ *
+ *              Every thread repeatedly takes the lowest nonce that has not
+ *              been tried yet and runs its attempt, until an attempt has
+ *              been accepted and all lower nonces have been rejected. The
+ *              signature of the lowest accepted nonce is returned, so the
+ *              result is the same as for crypto_sign_signature_expanded()
+ *              with the same randomness. Only one signature may be
+ *              computed in a pool at a time.
+ *
+ * Arguments:   - mld_sign_pool *pool: pointer to pool
+ *              - other arguments as for crypto_sign_signature_expanded()
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int mld_sign_pool_signature_expanded(mld_sign_pool *pool, uint8_t *sig,
+                                     size_t *siglen, const uint8_t *m,
+                                     size_t mlen, const uint8_t *ctx,
+                                     size_t ctxlen,
+                                     const mld_expanded_sk *esk);
+
+#define mld_sign_pool_signature MLD_NAMESPACE(sign_pool_signature)
+/*************************************************
+ * Name:        mld_sign_pool_signature
+ *
+ * Description: Computes signature using all threads of the pool, see
+ *              mld_sign_pool_signature_expanded(). The secret key is
+ *              expanded into the pool by the calling thread.
+ *
+ * Arguments:   - mld_sign_pool *pool: pointer to pool
+ *              - other arguments as for crypto_sign_signature()
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int mld_sign_pool_signature(mld_sign_pool *pool, uint8_t *sig, size_t *siglen,
+                            const uint8_t *m, size_t mlen, const uint8_t *ctx,
+                            size_t ctxlen, const uint8_t *sk);
+
+#endif /* MLD_CONFIG_USE_PTHREADS */
+
+#endif /* !MLD_SIGN_POOL_H */
@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include "fips202/fips202.h"
+#include "fips202/fips202x4.h"
 
 typedef keccak_state stream128_state;
 typedef keccak_state stream256_state;
@@ -23,6 +23,9 @@
 #if defined(__AVX2__)
 #define MLD_SYS_X86_64_AVX2
 #endif
+#if defined(__BMI__) && defined(__BMI2__)
+#define MLD_SYS_X86_64_BMI2
+#endif
 #endif /* __x86_64__ */
 
 #if defined(_WIN32)
@@ -121,6 +124,21 @@
 #define MLD_ALIGN /* No known support for alignment constraints */
 #endif
 
+/* Thread-local storage, used only for the optional signing statistics.
+ * C99 has no keyword for it, so fall back to compiler extensions. Without
+ * any, the counters would be shared and updated by all signing threads
+ * without synchronisation, so the statistics cannot be built. */
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_THREADS__)
+#define MLD_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define MLD_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define MLD_THREAD_LOCAL __declspec(thread)
+#elif defined(MLD_CONFIG_SIGN_STATS)
+#error "MLD_CONFIG_SIGN_STATS requires thread-local storage"
+#endif
+
 
 /* New X86_64 CPUs support Conflow-flow protection using the CET instructions.
  * When enabled (through -fcf-protection=), all compilation units (including
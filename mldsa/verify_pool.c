@@ -0,0 +1,448 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "verify_pool.h"
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "randombytes.h"
+#include "sign.h"
+
+/* Maximum number of signatures per task. Small tasks balance well, and
+ * consecutive tasks of a group still share the expanded key. */
+#define MLD_POOL_TASK_JOBS 8
+
+/* Number of 32-bit words of a public key that are hashed */
+#define MLD_POOL_HASH_WORDS (CRYPTO_PUBLICKEYBYTES / 4)
+
+#define MLD_POOL_NO_GROUP ((size_t)-1)
+
+/* Signatures order[begin], ..., order[end - 1] under public key group */
+typedef struct
+{
+  size_t begin, end;
+  size_t group;
+} mld_pool_task;
+
+/* Per-thread state. The task queue is the range [head, tail) of
+ * pool->tasks; the owner pops from the head, other threads steal from
+ * the tail. */
+typedef struct
+{
+  mld_verify_pool *pool;
+  pthread_mutex_t lock;
+  size_t head, tail;
+  size_t group; /* group of the key in epk, or MLD_POOL_NO_GROUP */
+  mld_expanded_pk epk;
+} mld_pool_worker;
+
+struct mld_verify_pool
+{
+  unsigned nthreads; /* number of running threads, including the caller */
+  unsigned nworkers;
+  pthread_t *threads;
+  mld_pool_worker *workers;
+
+  /* Random multipliers of the public key hash */
+  uint64_t hkey[MLD_POOL_HASH_WORDS];
+
+  pthread_mutex_t lock;
+  pthread_cond_t start, done;
+  unsigned long generation;
+  unsigned running;
+  int shutdown;
+
+  /* Current batch */
+  const mld_verify_job *jobs;
+  int *ret;
+  const size_t *order;
+  const mld_pool_task *tasks;
+};
+
+/*************************************************
+ * Name:        mld_pool_hash
+ *
+ * Description: Multilinear hash of a public key, with the multipliers
+ *              drawn at pool creation. Distinct keys collide with
+ *              probability about 2^-bits regardless of how they were
+ *              chosen, so that crafted keys cannot degrade grouping.
+ *
+ * Returns the upper bits bits of the hash
+ **************************************************/
+static size_t mld_pool_hash(const mld_verify_pool *pool, const uint8_t *pk,
+                            unsigned bits)
+{
+  unsigned int i;
+  uint64_t h = 0;
+
+  for (i = 0; i < MLD_POOL_HASH_WORDS; i++)
+  {
+    uint64_t w = (uint64_t)pk[4 * i] | (uint64_t)pk[4 * i + 1] << 8 |
+                 (uint64_t)pk[4 * i + 2] << 16 | (uint64_t)pk[4 * i + 3] << 24;
+    h += pool->hkey[i] * w;
+  }
+  return bits == 0 ? 0 : (size_t)(h >> (64 - bits));
+}
+
+/*************************************************
+ * Name:        mld_pool_pop
+ *
+ * Description: Takes the next task from the own queue, or steals the
+ *              last task from the queue of another thread.
+ *
+ * Returns pointer to the task, or NULL if all queues are empty
+ **************************************************/
+static const mld_pool_task *mld_pool_pop(mld_verify_pool *pool, unsigned id)
+{
+  unsigned int i;
+  const mld_pool_task *t = NULL;
+  mld_pool_worker *w;
+
+  w = &pool->workers[id];
+  pthread_mutex_lock(&w->lock);
+  if (w->head < w->tail)
+  {
+    t = &pool->tasks[w->head++];
+  }
+  pthread_mutex_unlock(&w->lock);
+
+  for (i = 1; t == NULL && i < pool->nthreads; i++)
+  {
+    w = &pool->workers[(id + i) % pool->nthreads];
+    pthread_mutex_lock(&w->lock);
+    if (w->head < w->tail)
+    {
+      t = &pool->tasks[--w->tail];
+    }
+    pthread_mutex_unlock(&w->lock);
+  }
+  return t;
+}
+
+/*************************************************
+ * Name:        mld_pool_work
+ *
+ * Description: Runs tasks of the current batch on thread id until all
+ *              queues are empty.
+ **************************************************/
+static void mld_pool_work(mld_verify_pool *pool, unsigned id)
+{
+  size_t i, n;
+  mld_pool_worker *w = &pool->workers[id];
+  const mld_pool_task *t;
+  const mld_verify_job *job;
+  const uint8_t *sig[MLD_POOL_TASK_JOBS], *m[MLD_POOL_TASK_JOBS];
+  const uint8_t *ctx[MLD_POOL_TASK_JOBS];
+  size_t siglen[MLD_POOL_TASK_JOBS], mlen[MLD_POOL_TASK_JOBS];
+  size_t ctxlen[MLD_POOL_TASK_JOBS];
+  int r[MLD_POOL_TASK_JOBS];
+
+  while ((t = mld_pool_pop(pool, id)) != NULL)
+  {
+    n = t->end - t->begin;
+    job = &pool->jobs[pool->order[t->begin]];
+
+    /* A single signature under a key that is not at hand is cheaper to
+     * verify directly than through the expanded key */
+    if (n == 1 && w->group != t->group)
+    {
+      pool->ret[pool->order[t->begin]] =
+          crypto_sign_verify(job->sig, job->siglen, job->m, job->mlen,
+                             job->ctx, job->ctxlen, job->pk);
+      continue;
+    }
+
+    if (w->group != t->group)
+    {
+      crypto_sign_expand_pk(&w->epk, job->pk);
+      w->group = t->group;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+      job = &pool->jobs[pool->order[t->begin + i]];
+      sig[i] = job->sig;
+      siglen[i] = job->siglen;
+      m[i] = job->m;
+      mlen[i] = job->mlen;
+      ctx[i] = job->ctx;
+      ctxlen[i] = job->ctxlen;
+    }
+    crypto_sign_verify_batch_expanded(r, sig, siglen, m, mlen, ctx, ctxlen, n,
+                                      &w->epk);
+    for (i = 0; i < n; i++)
+    {
+      pool->ret[pool->order[t->begin + i]] = r[i];
+    }
+  }
+}
+
+static void *mld_pool_thread(void *arg)
+{
+  mld_pool_worker *w = (mld_pool_worker *)arg;
+  mld_verify_pool *pool = w->pool;
+  unsigned id = (unsigned)(w - pool->workers);
+  unsigned long seen = 0;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->generation == seen && !pool->shutdown)
+    {
+      pthread_cond_wait(&pool->start, &pool->lock);
+    }
+    if (pool->shutdown)
+    {
+      pthread_mutex_unlock(&pool->lock);
+      return NULL;
+    }
+    seen = pool->generation;
+    pthread_mutex_unlock(&pool->lock);
+
+    mld_pool_work(pool, id);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0)
+    {
+      pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+mld_verify_pool *mld_verify_pool_create(unsigned nthreads)
+{
+  unsigned int i;
+  mld_verify_pool *pool;
+
+  if (nthreads == 0)
+  {
+    return NULL;
+  }
+
+  pool = (mld_verify_pool *)calloc(1, sizeof(mld_verify_pool));
+  if (pool == NULL)
+  {
+    return NULL;
+  }
+  pool->workers =
+      (mld_pool_worker *)calloc(nthreads, sizeof(mld_pool_worker));
+  pool->threads = (pthread_t *)calloc(nthreads, sizeof(pthread_t));
+  if (pool->workers == NULL || pool->threads == NULL)
+  {
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+    return NULL;
+  }
+
+  randombytes((uint8_t *)pool->hkey, sizeof(pool->hkey));
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  pool->nworkers = nthreads;
+  for (i = 0; i < nthreads; i++)
+  {
+    pool->workers[i].pool = pool;
+    pthread_mutex_init(&pool->workers[i].lock, NULL);
+  }
+
+  /* Thread 0 is the caller of mld_verify_pool_run() */
+  pool->nthreads = 1;
+  for (i = 1; i < nthreads; i++)
+  {
+    if (pthread_create(&pool->threads[i], NULL, mld_pool_thread,
+                       &pool->workers[i]) != 0)
+    {
+      mld_verify_pool_destroy(pool);
+      return NULL;
+    }
+    pool->nthreads++;
+  }
+  return pool;
+}
+
+void mld_verify_pool_destroy(mld_verify_pool *pool)
+{
+  unsigned int i;
+
+  if (pool == NULL)
+  {
+    return;
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdown = 1;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  for (i = 1; i < pool->nthreads; i++)
+  {
+    pthread_join(pool->threads[i], NULL);
+  }
+
+  for (i = 0; i < pool->nworkers; i++)
+  {
+    pthread_mutex_destroy(&pool->workers[i].lock);
+  }
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->start);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->threads);
+  free(pool->workers);
+  free(pool);
+}
+
+int mld_verify_pool_run(mld_verify_pool *pool, int *ret,
+                        const mld_verify_job *jobs, size_t njobs)
+{
+  size_t i, j, g, ngroups, ntasks, cap, slot;
+  size_t *table, *group, *start, *order;
+  mld_pool_task *tasks;
+  unsigned int bits;
+  int res = 0;
+
+  if (njobs == 0)
+  {
+    return 0;
+  }
+
+  /* Hash table with at least 2 * njobs slots */
+  for (bits = 1, cap = 2; cap < 2 * njobs; bits++)
+  {
+    cap *= 2;
+  }
+  table = (size_t *)malloc(cap * sizeof(size_t));
+  group = (size_t *)malloc(njobs * sizeof(size_t));
+  start = (size_t *)malloc((njobs + 1) * sizeof(size_t));
+  order = (size_t *)malloc(njobs * sizeof(size_t));
+  tasks = (mld_pool_task *)malloc(njobs * sizeof(mld_pool_task));
+  if (table == NULL || group == NULL || start == NULL || order == NULL ||
+      tasks == NULL)
+  {
+    for (i = 0; i < njobs; i++)
+    {
+      ret[i] = -1;
+    }
+    res = -1;
+    goto cleanup;
+  }
+
+  /* Group jobs by public key. group[i] is the group of job i, and
+   * order[g] temporarily holds the first job of group g. Consecutive
+   * jobs with the same key pointer skip the lookup. */
+  for (slot = 0; slot < cap; slot++)
+  {
+    table[slot] = MLD_POOL_NO_GROUP;
+  }
+  ngroups = 0;
+  for (i = 0; i < njobs; i++)
+  {
+    if (i > 0 && jobs[i].pk == jobs[i - 1].pk)
+    {
+      group[i] = group[i - 1];
+      continue;
+    }
+
+    slot = mld_pool_hash(pool, jobs[i].pk, bits);
+    for (;;)
+    {
+      g = table[slot];
+      if (g == MLD_POOL_NO_GROUP)
+      {
+        g = ngroups++;
+        order[g] = i;
+        table[slot] = g;
+        break;
+      }
+      if (jobs[order[g]].pk == jobs[i].pk ||
+          memcmp(jobs[order[g]].pk, jobs[i].pk, CRYPTO_PUBLICKEYBYTES) == 0)
+      {
+        break;
+      }
+      slot = (slot + 1) & (cap - 1);
+    }
+    group[i] = g;
+  }
+
+  /* Counting sort of the jobs by group */
+  for (g = 0; g <= ngroups; g++)
+  {
+    start[g] = 0;
+  }
+  for (i = 0; i < njobs; i++)
+  {
+    start[group[i] + 1]++;
+  }
+  for (g = 0; g < ngroups; g++)
+  {
+    start[g + 1] += start[g];
+  }
+  for (i = 0; i < njobs; i++)
+  {
+    order[start[group[i]]++] = i;
+  }
+
+  /* start[g] now is the end of group g. Split groups into tasks. */
+  ntasks = 0;
+  for (g = 0, j = 0; g < ngroups; g++)
+  {
+    for (; j < start[g]; j += MLD_POOL_TASK_JOBS)
+    {
+      tasks[ntasks].begin = j;
+      tasks[ntasks].end =
+          start[g] - j < MLD_POOL_TASK_JOBS ? start[g] : j + MLD_POOL_TASK_JOBS;
+      tasks[ntasks].group = g;
+      ntasks++;
+    }
+    j = start[g];
+  }
+
+  /* Hand out contiguous ranges of tasks and wake up the workers */
+  pthread_mutex_lock(&pool->lock);
+  pool->jobs = jobs;
+  pool->ret = ret;
+  pool->order = order;
+  pool->tasks = tasks;
+  for (i = 0; i < pool->nthreads; i++)
+  {
+    pool->workers[i].head = ntasks * i / pool->nthreads;
+    pool->workers[i].tail = ntasks * (i + 1) / pool->nthreads;
+    pool->workers[i].group = MLD_POOL_NO_GROUP;
+  }
+  pool->running = pool->nthreads - 1;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+
+  mld_pool_work(pool, 0);
+
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running > 0)
+  {
+    pthread_cond_wait(&pool->done, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  for (i = 0; i < njobs; i++)
+  {
+    res |= ret[i];
+  }
+
+cleanup:
+  free(tasks);
+  free(order);
+  free(start);
+  free(group);
+  free(table);
+  return res;
+}
+
+#else /* MLD_CONFIG_USE_PTHREADS */
+
+MLD_EMPTY_CU(verify_pool)
+
+#endif /* !MLD_CONFIG_USE_PTHREADS */
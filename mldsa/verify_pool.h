@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_VERIFY_POOL_H
+#define MLD_VERIFY_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+
+/* One signature to be verified by a verification pool. All pointers must
+ * remain valid until mld_verify_pool_run() returns. */
+typedef struct
+{
+  const uint8_t *pk;
+  const uint8_t *sig;
+  size_t siglen;
+  const uint8_t *m;
+  size_t mlen;
+  const uint8_t *ctx;
+  size_t ctxlen;
+} mld_verify_job;
+
+/* Opaque verification pool, see mld_verify_pool_create() */
+typedef struct mld_verify_pool mld_verify_pool;
+
+#define mld_verify_pool_create MLD_NAMESPACE(verify_pool_create)
+/*************************************************
+ * Name:        mld_verify_pool_create
+ *
+ * Description: Creates a pool of nthreads - 1 worker threads which,
+ *              together with the calling thread, verify batches of
+ *              signatures in mld_verify_pool_run().
+ *
+ *              The workers are started once and sleep between batches.
+ *
+ * Arguments:   - unsigned nthreads: number of threads, at least 1
+ *
+ * Returns pointer to the pool, or NULL if allocation or thread creation
+ * failed
+ **************************************************/
+mld_verify_pool *mld_verify_pool_create(unsigned nthreads);
+
+#define mld_verify_pool_destroy MLD_NAMESPACE(verify_pool_destroy)
+/*************************************************
+ * Name:        mld_verify_pool_destroy
+ *
+ * Description: Stops the worker threads and frees the pool.
+ *
+ * Arguments:   - mld_verify_pool *pool: pointer to pool, or NULL
+ **************************************************/
+void mld_verify_pool_destroy(mld_verify_pool *pool);
+
+#define mld_verify_pool_run MLD_NAMESPACE(verify_pool_run)
+/*************************************************
+ * Name:        mld_verify_pool_run
+ *
+ * Description: Verifies a batch of signatures under any number of public
+ *              keys, using all threads of the pool.
+ *
+ *              Jobs are grouped by public key, and each group is split
+ *              into tasks of a few signatures, which are verified with
+ *              crypto_sign_verify_batch_expanded(). Tasks are distributed
+ *              evenly over per-thread queues; a thread that runs out of
+ *              tasks steals from the back of the other queues. Each
+ *              thread keeps the last public key it expanded, so
+ *              consecutive tasks of a group share one key expansion.
+ *
+ *              The result for every job is the same as for
+ *              crypto_sign_verify(). Only one batch may run in a pool at
+ *              a time.
+ *
+ * Arguments:   - mld_verify_pool *pool: pointer to pool
+ *              - int *ret: output array of njobs results, 0 if the i-th
+ *                          signature could be verified correctly and -1
+ *                          otherwise
+ *              - const mld_verify_job *jobs: array of njobs jobs
+ *              - size_t njobs: number of jobs
+ *
+ * Returns 0 if all signatures could be verified correctly, and -1
+ * otherwise or if memory allocation failed
+ **************************************************/
+int mld_verify_pool_run(mld_verify_pool *pool, int *ret,
+                        const mld_verify_job *jobs, size_t njobs);
+
+#endif /* MLD_CONFIG_USE_PTHREADS */
+
+#endif /* !MLD_VERIFY_POOL_H */
@@ -0,0 +1,14 @@
+// Copyright (c) 2025 The mldsa-native project authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fips202/fips202.h"
+
+void harness(void)
+{
+  uint8_t *out;
+  const uint64_t *s;
+  unsigned int pos;
+  unsigned int len;
+
+  keccak_extract_bytes(out, s, pos, len);
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2025 The mldsa-native project authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fips202/fips202.h"
+
+void harness(void)
+{
+  uint64_t *s;
+  unsigned int pos;
+  const uint8_t *in;
+  unsigned int len;
+
+  keccak_xor_bytes(s, pos, in, len);
+}
@@ -3,8 +3,6 @@
 
 #include "fips202/fips202.h"
 
-extern void KeccakF1600_StatePermute(uint64_t state[25]);
-
 void harness(void)
 {
   uint64_t *a;
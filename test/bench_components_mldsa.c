@@ -8,19 +8,51 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "../mldsa/fips202/fips202.h"
+#include "../mldsa/fips202/fips202x4.h"
 #include "../mldsa/ntt.h"
+#include "../mldsa/packing.h"
+#include "../mldsa/poly.h"
+#include "../mldsa/polyvec.h"
 #include "../mldsa/randombytes.h"
+#include "../mldsa/sign.h"
 #include "hal.h"
 
 #define NWARMUP 50
-#define NITERATIONS 300
-#define NTESTS 20
+#define NITERATIONS 100
+#define NTESTS 100
+#define MAXLEN 2048
 
 static int cmp_uint64_t(const void *a, const void *b)
 {
   return (int)((*((const uint64_t *)a)) - (*((const uint64_t *)b)));
 }
 
+static int percentiles[] = {1, 10, 20, 30, 40, 50, 60, 70, 80, 90, 99};
+
+static void print_percentile_legend(void)
+{
+  unsigned i;
+  printf("%39s", "percentile");
+  for (i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+  {
+    printf("%7d", percentiles[i]);
+  }
+  printf("\n");
+}
+
+static void print_results(const char *txt, uint64_t cyc[NTESTS])
+{
+  unsigned i;
+  printf("%26s cycles = %" PRIu64 "\n", txt, cyc[NTESTS >> 1] / NITERATIONS);
+  printf("%26s percentiles:", txt);
+  for (i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+  {
+    printf("%7" PRIu64, (cyc)[NTESTS * percentiles[i] / 100] / NITERATIONS);
+  }
+  printf("\n");
+}
+
 #define BENCH(txt, code)                                \
   for (i = 0; i < NTESTS; i++)                          \
   {                                                     \
@@ -39,17 +71,146 @@ static int cmp_uint64_t(const void *a, const void *b)
     (cyc)[i] = t1 - t0;                                 \
   }                                                     \
   qsort((cyc), NTESTS, sizeof(uint64_t), cmp_uint64_t); \
-  printf(txt " cycles=%" PRIu64 "\n", (cyc)[NTESTS >> 1] / NITERATIONS);
+  print_results(txt, cyc);
+
+/* Valid keys and signature, so that the packing and rounding routines
+ * run on inputs within their bounds */
+static uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[CRYPTO_SECRETKEYBYTES];
+static uint8_t sig[CRYPTO_BYTES];
+static uint8_t rho[MLDSA_SEEDBYTES], tr[MLDSA_TRBYTES], key[MLDSA_SEEDBYTES];
+static uint8_t c[MLDSA_CTILDEBYTES];
+static polyvecl s1, z;
+static polyveck s2, t0v, t1v, h;
+
+static poly a, b, a0, a1, hint, r[4];
+static polyvecl u, v;
+static uint8_t seed[4][MLDSA_CRHBYTES];
+static uint8_t buf[4][MAXLEN];
+static uint64_t state[MLD_KECCAK_LANES];
+static keccak_state ks;
+static keccakx4_state ks4;
+
+static void random_poly(poly *p)
+{
+  unsigned k;
+  randombytes((uint8_t *)p->coeffs, sizeof(p->coeffs));
+  for (k = 0; k < MLDSA_N; k++)
+  {
+    p->coeffs[k] = (int32_t)((uint32_t)p->coeffs[k] % MLDSA_Q);
+  }
+}
 
 static int bench(void)
 {
   int32_t data0[256];
   uint64_t cyc[NTESTS];
-  unsigned i, j;
+  unsigned i, j, k, nhints;
   uint64_t t0, t1;
+  size_t len;
+  char txt[32];
+  static const size_t lens[] = {32, 256, MAXLEN};
+
+  crypto_sign_keypair(pk, sk);
+  crypto_sign_signature(sig, &len, pk, 32, NULL, 0, sk);
+  unpack_pk(rho, &t1v, pk);
+  unpack_sk(rho, tr, key, &t0v, &s1, &s2, sk);
+  unpack_sig(c, &z, &h, sig);
+  nhints = 0;
+  for (k = 0; k < MLDSA_K; k++)
+  {
+    for (j = 0; j < MLDSA_N; j++)
+    {
+      nhints += (unsigned)h.vec[k].coeffs[j];
+    }
+  }
+
+  random_poly(&a);
+  random_poly(&b);
+  for (k = 0; k < MLDSA_L; k++)
+  {
+    random_poly(&u.vec[k]);
+    random_poly(&v.vec[k]);
+  }
+  poly_decompose(&a1, &a0, &a);
+  poly_make_hint(&hint, &a0, &a1);
+  randombytes((uint8_t *)seed, sizeof(seed));
+  randombytes((uint8_t *)buf, sizeof(buf));
+  randombytes((uint8_t *)state, sizeof(state));
 
-  /* ntt */
+  print_percentile_legend();
+
+  /* NTT and multiplication */
   BENCH("ntt", ntt(data0))
+  BENCH("invntt_tomont", invntt_tomont(data0))
+  BENCH("poly_pointwise_montgomery",
+        poly_pointwise_montgomery(&r[0], &a, &b))
+  BENCH("polyvecl_pointwise_acc",
+        polyvecl_pointwise_acc_montgomery(&r[0], &u, &v))
+
+  /* Sampling */
+  BENCH("poly_uniform", poly_uniform(&r[0], seed[0], 0))
+  BENCH("poly_uniform_4x",
+        poly_uniform_4x(&r[0], &r[1], &r[2], &r[3], seed[0], 0, 1, 2, 3))
+  BENCH("poly_uniform_eta", poly_uniform_eta(&r[0], seed[0], 0))
+  BENCH("poly_uniform_eta_4x",
+        poly_uniform_eta_4x(&r[0], &r[1], &r[2], &r[3], seed[0], 0, 1, 2, 3))
+  BENCH("poly_uniform_gamma1", poly_uniform_gamma1(&r[0], seed[0], 0))
+  BENCH("poly_uniform_gamma1_4x",
+        poly_uniform_gamma1_4x(&r[0], &r[1], &r[2], &r[3], seed[0], seed[1],
+                               seed[2], seed[3], 0, 1, 2, 3))
+  BENCH("poly_challenge", poly_challenge(&r[0], seed[0]))
+  BENCH("poly_challenge_4x", poly_challenge_4x(&r[0], &r[1], &r[2], &r[3],
+                                               seed[0], seed[1], seed[2],
+                                               seed[3]))
+
+  /* Rounding */
+  BENCH("poly_power2round", poly_power2round(&r[0], &r[1], &a))
+  BENCH("poly_decompose", poly_decompose(&r[0], &r[1], &a))
+  BENCH("poly_make_hint", poly_make_hint(&r[0], &a0, &a1))
+  BENCH("poly_use_hint", poly_use_hint(&r[0], &a, &hint))
+
+  /* Polynomial packing */
+  BENCH("polyeta_pack", polyeta_pack(buf[0], &s1.vec[0]))
+  BENCH("polyeta_unpack", polyeta_unpack(&r[0], buf[0]))
+  BENCH("polyt1_pack", polyt1_pack(buf[0], &t1v.vec[0]))
+  BENCH("polyt1_unpack", polyt1_unpack(&r[0], buf[0]))
+  BENCH("polyt0_pack", polyt0_pack(buf[0], &t0v.vec[0]))
+  BENCH("polyt0_unpack", polyt0_unpack(&r[0], buf[0]))
+  BENCH("polyz_pack", polyz_pack(buf[0], &z.vec[0]))
+  BENCH("polyz_unpack", polyz_unpack(&r[0], buf[0]))
+  BENCH("polyw1_pack", polyw1_pack(buf[0], &a1))
+
+  /* Key and signature packing */
+  BENCH("pack_pk", pack_pk(pk, rho, &t1v))
+  BENCH("unpack_pk", unpack_pk(rho, &t1v, pk))
+  BENCH("pack_sk", pack_sk(sk, rho, tr, key, &t0v, &s1, &s2))
+  BENCH("unpack_sk", unpack_sk(rho, tr, key, &t0v, &s1, &s2, sk))
+  BENCH("pack_sig", pack_sig(sig, c, &z, &h, nhints))
+  BENCH("unpack_sig", unpack_sig(c, &z, &h, sig))
+
+  /* Keccak; squeezing one block of SHAKE128x4 is one 4-way permutation */
+  BENCH("keccakf1600", KeccakF1600_StatePermute(state))
+  BENCH("keccakf1600_x4",
+        shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &ks4))
+
+  /* SHAKE. Absorbing includes init and finalize, and permutes once per
+   * full block; the permutation after the padding runs in the first
+   * squeeze. */
+  for (k = 0; k < sizeof(lens) / sizeof(lens[0]); k++)
+  {
+    len = lens[k];
+    sprintf(txt, "shake128_absorb_%u", (unsigned)len);
+    BENCH(txt, shake128_init(&ks); shake128_absorb(&ks, buf[0], len);
+          shake128_finalize(&ks))
+    sprintf(txt, "shake128_squeeze_%u", (unsigned)len);
+    BENCH(txt, shake128_squeeze(buf[1], len, &ks))
+    sprintf(txt, "shake256_absorb_%u", (unsigned)len);
+    BENCH(txt, shake256_init(&ks); shake256_absorb(&ks, buf[0], len);
+          shake256_finalize(&ks))
+    sprintf(txt, "shake256_squeeze_%u", (unsigned)len);
+    BENCH(txt, shake256_squeeze(buf[1], len, &ks))
+  }
 
   return 0;
 }
@@ -78,6 +78,18 @@ static int bench(void)
   uint64_t t0, t1;
 
   uint64_t cycles_kg[NTESTS], cycles_sign[NTESTS], cycles_verify[NTESTS];
+  uint64_t cycles_expand[NTESTS], cycles_sign_exp[NTESTS];
+  uint64_t cycles_expand_pk[NTESTS], cycles_verify_exp[NTESTS];
+  uint64_t cycles_verify_batch[NTESTS], cycles_sign_batch[NTESTS];
+  static uint8_t batch_out[NITERATIONS][CRYPTO_BYTES];
+  uint8_t *batch_outp[NITERATIONS];
+  const uint8_t *batch_sig[NITERATIONS], *batch_m[NITERATIONS];
+  const uint8_t *batch_ctx[NITERATIONS];
+  size_t batch_siglen[NITERATIONS], batch_mlen[NITERATIONS];
+  size_t batch_ctxlen[NITERATIONS];
+  int batch_ret[NITERATIONS];
+  mld_expanded_sk esk;
+  mld_expanded_pk epk;
   unsigned char pre[CTXLEN + 2];
 
   for (i = 0; i < NTESTS; i++)
@@ -126,6 +138,33 @@ static int bench(void)
     t1 = get_cyclecounter();
     cycles_sign[i] = t1 - t0;
 
+    /* Signing with expanded secret key */
+    for (j = 0; j < NWARMUP; j++)
+    {
+      ret |= crypto_sign_expand_sk(&esk, sk);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      ret |= crypto_sign_expand_sk(&esk, sk);
+    }
+    t1 = get_cyclecounter();
+    cycles_expand[i] = t1 - t0;
+
+    for (j = 0; j < NWARMUP; j++)
+    {
+      ret |= crypto_sign_signature_expanded_internal(
+          sig, &siglen, m, MLEN, pre, CTXLEN + 2, sig_rand, &esk, 0);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      ret |= crypto_sign_signature_expanded_internal(
+          sig, &siglen, m, MLEN, pre, CTXLEN + 2, sig_rand, &esk, 0);
+    }
+    t1 = get_cyclecounter();
+    cycles_sign_exp[i] = t1 - t0;
+
     /* Verification */
     for (j = 0; j < NWARMUP; j++)
     {
@@ -139,16 +178,107 @@ static int bench(void)
     t1 = get_cyclecounter();
     cycles_verify[i] = t1 - t0;
 
+    /* Verification with expanded public key */
+    for (j = 0; j < NWARMUP; j++)
+    {
+      ret |= crypto_sign_expand_pk(&epk, pk);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      ret |= crypto_sign_expand_pk(&epk, pk);
+    }
+    t1 = get_cyclecounter();
+    cycles_expand_pk[i] = t1 - t0;
+
+    for (j = 0; j < NWARMUP; j++)
+    {
+      ret |= crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN,
+                                         &epk);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      ret |= crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN,
+                                         &epk);
+    }
+    t1 = get_cyclecounter();
+    cycles_verify_exp[i] = t1 - t0;
+
+    /* Batch verification of NITERATIONS signatures under one key,
+     * including the key expansion */
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      batch_sig[j] = sig;
+      batch_siglen[j] = siglen;
+      batch_m[j] = m;
+      batch_mlen[j] = MLEN;
+      batch_ctx[j] = ctx;
+      batch_ctxlen[j] = CTXLEN;
+    }
+    ret |= crypto_sign_verify_batch(batch_ret, batch_sig, batch_siglen,
+                                    batch_m, batch_mlen, batch_ctx,
+                                    batch_ctxlen, NITERATIONS, pk);
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_verify_batch(batch_ret, batch_sig, batch_siglen,
+                                    batch_m, batch_mlen, batch_ctx,
+                                    batch_ctxlen, NITERATIONS, pk);
+    t1 = get_cyclecounter();
+    cycles_verify_batch[i] = t1 - t0;
+
+    /* Batch signing of NITERATIONS messages under one key, including the
+     * key expansion */
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      batch_outp[j] = batch_out[j];
+    }
+    ret |= crypto_sign_signature_batch(batch_outp, batch_siglen, batch_m,
+                                       batch_mlen, batch_ctx, batch_ctxlen,
+                                       NITERATIONS, sk);
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_signature_batch(batch_outp, batch_siglen, batch_m,
+                                       batch_mlen, batch_ctx, batch_ctxlen,
+                                       NITERATIONS, sk);
+    t1 = get_cyclecounter();
+    cycles_sign_batch[i] = t1 - t0;
+
     CHECK(ret == 0);
   }
 
   qsort(cycles_kg, NTESTS, sizeof(uint64_t), cmp_uint64_t);
   qsort(cycles_sign, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_expand, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_sign_exp, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_expand_pk, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_verify_exp, NTESTS, sizeof(uint64_t), cmp_uint64_t);
   qsort(cycles_verify, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_verify_batch, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_sign_batch, NTESTS, sizeof(uint64_t), cmp_uint64_t);
 
   print_median("keypair", cycles_kg);
   print_median("sign", cycles_sign);
   print_median("verify", cycles_verify);
+  print_median("expand_sk", cycles_expand);
+  print_median("sign_exp", cycles_sign_exp);
+  print_median("expand_pk", cycles_expand_pk);
+  print_median("verify_exp", cycles_verify_exp);
+  print_median("verify_batch", cycles_verify_batch);
+  print_median("sign_batch", cycles_sign_batch);
+
+  /* Cost per message when the expanded key is reused, relative to
+   * using the packed key */
+  printf("%10s speedup = %.2fx\n", "sign_exp",
+         (double)cycles_sign[NTESTS >> 1] /
+             (double)cycles_sign_exp[NTESTS >> 1]);
+  printf("%10s speedup = %.2fx\n", "verify_exp",
+         (double)cycles_verify[NTESTS >> 1] /
+             (double)cycles_verify_exp[NTESTS >> 1]);
+  printf("%10s speedup = %.2fx\n", "verify_batch",
+         (double)cycles_verify[NTESTS >> 1] /
+             (double)cycles_verify_batch[NTESTS >> 1]);
+  printf("%10s speedup = %.2fx\n", "sign_batch",
+         (double)cycles_sign[NTESTS >> 1] /
+             (double)cycles_sign_batch[NTESTS >> 1]);
 
   printf("\n");
 
@@ -157,6 +287,12 @@ static int bench(void)
   print_percentiles("keypair", cycles_kg);
   print_percentiles("sign", cycles_sign);
   print_percentiles("verify", cycles_verify);
+  print_percentiles("expand_sk", cycles_expand);
+  print_percentiles("sign_exp", cycles_sign_exp);
+  print_percentiles("expand_pk", cycles_expand_pk);
+  print_percentiles("verify_exp", cycles_verify_exp);
+  print_percentiles("verify_batch", cycles_verify_batch);
+  print_percentiles("sign_batch", cycles_sign_batch);
 
   return 0;
 }
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Latency benchmark of the multi-threaded signing pool.
+ *
+ * Signs a series of messages under one expanded secret key with 1, 2,
+ * 4, ... threads up to the number of online CPUs (or the number given as
+ * the first argument), and reports the median, 99th percentile and
+ * maximum wall-clock time per signature. The pool and the sequential
+ * rejection loop draw the same randomness, so they make the same number
+ * of attempts. The correctness of the pool is checked in test_mldsa. */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../mldsa/sign.h"
+#include "../mldsa/sign_pool.h"
+#include "notrandombytes/notrandombytes.h"
+
+#define NSIGS 1000
+#define MLEN 59
+#define CTXLEN 1
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+
+#define CHECK(x)                                              \
+  do                                                          \
+  {                                                           \
+    int rc;                                                   \
+    rc = (x);                                                 \
+    if (!rc)                                                  \
+    {                                                         \
+      fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__); \
+      return 1;                                               \
+    }                                                         \
+  } while (0)
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static void print_latency(const char *name, unsigned t, double *lat)
+{
+  qsort(lat, NSIGS, sizeof(double), cmp_double);
+  printf("%7s threads = %3u: median %8.1f us, p99 %8.1f us, max %8.1f us\n",
+         name, t, 1e6 * lat[NSIGS / 2], 1e6 * lat[NSIGS * 99 / 100],
+         1e6 * lat[NSIGS - 1]);
+}
+
+static uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[CRYPTO_SECRETKEYBYTES];
+static mld_expanded_sk esk;
+static uint8_t m[NSIGS][MLEN];
+static uint8_t ctx[CTXLEN];
+static uint8_t sig[CRYPTO_BYTES];
+static double lat[NSIGS];
+
+static int bench(unsigned maxthreads)
+{
+  unsigned i, t;
+  size_t siglen;
+  double t0;
+  mld_sign_pool *pool;
+
+  CHECK(crypto_sign_keypair(pk, sk) == 0);
+  CHECK(crypto_sign_expand_sk(&esk, sk) == 0);
+  randombytes(ctx, CTXLEN);
+  for (i = 0; i < NSIGS; i++)
+  {
+    randombytes(m[i], MLEN);
+  }
+
+  /* Baseline: sequential rejection loop */
+  randombytes_reset();
+  for (i = 0; i < NSIGS; i++)
+  {
+    t0 = now();
+    CHECK(crypto_sign_signature_expanded(sig, &siglen, m[i], MLEN, ctx,
+                                         CTXLEN, &esk) == 0);
+    lat[i] = now() - t0;
+  }
+  print_latency("sign", 1, lat);
+
+  for (t = 1;; t = 2 * t < maxthreads ? 2 * t : maxthreads)
+  {
+    pool = mld_sign_pool_create(t);
+    CHECK(pool != NULL);
+
+    randombytes_reset();
+    for (i = 0; i < NSIGS; i++)
+    {
+      t0 = now();
+      CHECK(mld_sign_pool_signature_expanded(pool, sig, &siglen, m[i], MLEN,
+                                             ctx, CTXLEN, &esk) == 0);
+      lat[i] = now() - t0;
+    }
+    print_latency("pool", t, lat);
+    mld_sign_pool_destroy(pool);
+
+    if (t == maxthreads)
+    {
+      break;
+    }
+  }
+
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  long n;
+
+  n = argc > 1 ? atol(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+  if (n < 1)
+  {
+    n = 1;
+  }
+  printf("%d signatures under one expanded key\n", NSIGS);
+  return bench((unsigned)n);
+}
+
+#else /* MLD_CONFIG_USE_PTHREADS */
+
+int main(void)
+{
+  printf("Signing pool not built; rebuild with PTHREADS=1\n");
+  return 0;
+}
+
+#endif /* !MLD_CONFIG_USE_PTHREADS */
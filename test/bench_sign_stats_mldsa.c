@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Distribution of signing attempts and rejection causes.
+ *
+ * Signs a series of random messages under one key and prints, for every
+ * check of the rejection loop, the fraction of the attempts reaching it
+ * that it rejected. The checks on z and r0 are compared with the
+ * expectation for uniformly distributed y and w0 [Dilithium, Sec. 3.4]:
+ *
+ *   P(z passes)  = ((2 (gamma1 - beta) - 1) / (2 gamma1))^(N L)
+ *   P(r0 passes) = ((2 (gamma2 - beta) - 1) / (2 gamma2))^(N K)
+ *
+ * The checks on ct0 and on the number of hints have no simple closed
+ * form; they are expected to reject rarely. */
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "../mldsa/sign.h"
+#include "notrandombytes/notrandombytes.h"
+
+#define NSIGS 10000
+#define MLEN 32
+
+#if MLDSA_MODE == 2
+#define ALGNAME "ML-DSA-44"
+#elif MLDSA_MODE == 3
+#define ALGNAME "ML-DSA-65"
+#elif MLDSA_MODE == 5
+#define ALGNAME "ML-DSA-87"
+#endif
+
+#if defined(MLD_CONFIG_SIGN_STATS)
+
+#define CHECK(x)                                              \
+  do                                                          \
+  {                                                           \
+    int rc;                                                   \
+    rc = (x);                                                 \
+    if (!rc)                                                  \
+    {                                                         \
+      fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__); \
+      return 1;                                               \
+    }                                                         \
+  } while (0)
+
+/* Probability that all of n coefficients pass, each with probability p */
+static double pass_all(double p, unsigned n)
+{
+  double r = 1.0;
+  while (n-- > 0)
+  {
+    r *= p;
+  }
+  return r;
+}
+
+static double percent(uint64_t a, uint64_t b)
+{
+  return b == 0 ? 0.0 : 100.0 * (double)a / (double)b;
+}
+
+static uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[CRYPTO_SECRETKEYBYTES];
+static mld_expanded_sk esk;
+static uint8_t m[MLEN];
+static uint8_t sig[CRYPTO_BYTES];
+
+static int bench(unsigned long nsigs)
+{
+  unsigned long i;
+  size_t siglen;
+  uint64_t reached;
+  double pz, pr0;
+  mld_sign_stats s;
+
+  pz = pass_all((2.0 * (MLDSA_GAMMA1 - MLDSA_BETA) - 1) / (2.0 * MLDSA_GAMMA1),
+                MLDSA_N * MLDSA_L);
+  pr0 = pass_all((2.0 * (MLDSA_GAMMA2 - MLDSA_BETA) - 1) / (2.0 * MLDSA_GAMMA2),
+                 MLDSA_N * MLDSA_K);
+
+  CHECK(crypto_sign_keypair(pk, sk) == 0);
+  CHECK(crypto_sign_expand_sk(&esk, sk) == 0);
+
+  mld_sign_stats_reset();
+  for (i = 0; i < nsigs; i++)
+  {
+    randombytes(m, MLEN);
+    CHECK(crypto_sign_signature_expanded(sig, &siglen, m, MLEN, NULL, 0,
+                                         &esk) == 0);
+  }
+  mld_sign_stats_get(&s);
+  CHECK(s.attempts - s.rejected_z - s.rejected_r0 - s.rejected_ct0 -
+            s.rejected_hint ==
+        nsigs);
+
+  printf("%s: %lu signatures, %" PRIu64 " attempts\n", ALGNAME, nsigs,
+         s.attempts);
+  printf("%20s %10s %10s\n", "", "observed", "expected");
+  printf("%20s %10.2f %10.2f\n", "attempts/signature",
+         (double)s.attempts / (double)nsigs, 1.0 / (pz * pr0));
+
+  /* mld_sign_respond() runs the checks one after the other: all of z,
+   * all of r0, all of ct0, then the number of hints. The attempts reaching
+   * a check are those not rejected by an earlier one. */
+  reached = s.attempts;
+  printf("%20s %9.2f%% %9.2f%%\n", "z rejected", percent(s.rejected_z, reached),
+         100.0 * (1.0 - pz));
+  reached -= s.rejected_z;
+  printf("%20s %9.2f%% %9.2f%%\n", "r0 rejected",
+         percent(s.rejected_r0, reached), 100.0 * (1.0 - pr0));
+  reached -= s.rejected_r0;
+  printf("%20s %9.2f%% %10s\n", "ct0 rejected",
+         percent(s.rejected_ct0, reached), "-");
+  reached -= s.rejected_ct0;
+  printf("%20s %9.2f%% %10s\n", "hints rejected",
+         percent(s.rejected_hint, reached), "-");
+  printf("(rejection rates are relative to the attempts reaching the check)\n");
+  printf("\n");
+
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  long n;
+
+  n = argc > 1 ? atol(argv[1]) : NSIGS;
+  if (n < 1)
+  {
+    n = 1;
+  }
+  return bench((unsigned long)n);
+}
+
+#else /* MLD_CONFIG_SIGN_STATS */
+
+int main(void)
+{
+  printf("Signing statistics not built; rebuild with SIGN_STATS=1\n");
+  return 0;
+}
+
+#endif /* !MLD_CONFIG_SIGN_STATS */
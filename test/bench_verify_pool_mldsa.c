@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Throughput benchmark of the multi-threaded verification pool.
+ *
+ * Verifies a batch of signatures under a handful of public keys, in
+ * random order, with 1, 2, 4, ... threads up to the number of online
+ * CPUs (or the number given as the first argument), and reports
+ * signatures per second of wall-clock time. The correctness of the pool
+ * is checked in test_mldsa. */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../mldsa/randombytes.h"
+#include "../mldsa/sign.h"
+#include "../mldsa/verify_pool.h"
+
+#define NKEYS 16
+#define NJOBS 4096
+#define NRUNS 5
+#define MLEN 59
+#define CTXLEN 1
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+
+#define CHECK(x)                                              \
+  do                                                          \
+  {                                                           \
+    int rc;                                                   \
+    rc = (x);                                                 \
+    if (!rc)                                                  \
+    {                                                         \
+      fprintf(stderr, "ERROR (%s,%d)\n", __FILE__, __LINE__); \
+      return 1;                                               \
+    }                                                         \
+  } while (0)
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+}
+
+static uint8_t pk[NKEYS][CRYPTO_PUBLICKEYBYTES];
+static uint8_t sk[NKEYS][CRYPTO_SECRETKEYBYTES];
+static uint8_t sig[NJOBS][CRYPTO_BYTES];
+static uint8_t m[NJOBS][MLEN];
+static uint8_t ctx[NJOBS][CTXLEN];
+static mld_verify_job jobs[NJOBS];
+static int ret[NJOBS];
+
+static int bench(unsigned maxthreads)
+{
+  unsigned i, t, r;
+  uint8_t key;
+  double t0, best, base, single;
+  mld_verify_pool *pool;
+
+  for (i = 0; i < NKEYS; i++)
+  {
+    CHECK(crypto_sign_keypair(pk[i], sk[i]) == 0);
+  }
+
+  for (i = 0; i < NJOBS; i++)
+  {
+    randombytes(&key, 1);
+    key %= NKEYS;
+    randombytes(m[i], MLEN);
+    randombytes(ctx[i], CTXLEN);
+    jobs[i].pk = pk[key];
+    jobs[i].m = m[i];
+    jobs[i].mlen = MLEN;
+    jobs[i].ctx = ctx[i];
+    jobs[i].ctxlen = CTXLEN;
+    jobs[i].sig = sig[i];
+    CHECK(crypto_sign_signature(sig[i], &jobs[i].siglen, m[i], MLEN, ctx[i],
+                                CTXLEN, sk[key]) == 0);
+  }
+
+  /* Baseline: one crypto_sign_verify() per signature on one thread */
+  base = 0;
+  for (r = 0; r < NRUNS; r++)
+  {
+    t0 = now();
+    for (i = 0; i < NJOBS; i++)
+    {
+      CHECK(crypto_sign_verify(jobs[i].sig, jobs[i].siglen, jobs[i].m,
+                               jobs[i].mlen, jobs[i].ctx, jobs[i].ctxlen,
+                               jobs[i].pk) == 0);
+    }
+    t0 = now() - t0;
+    base = (r == 0 || t0 < base) ? t0 : base;
+  }
+  printf("%7s threads = %3u: %10.0f sig/s\n", "verify", 1u,
+         (double)NJOBS / base);
+
+  single = 0;
+  for (t = 1;; t = 2 * t < maxthreads ? 2 * t : maxthreads)
+  {
+    pool = mld_verify_pool_create(t);
+    CHECK(pool != NULL);
+
+    CHECK(mld_verify_pool_run(pool, ret, jobs, NJOBS) == 0);
+    best = 0;
+    for (r = 0; r < NRUNS; r++)
+    {
+      t0 = now();
+      CHECK(mld_verify_pool_run(pool, ret, jobs, NJOBS) == 0);
+      t0 = now() - t0;
+      best = (r == 0 || t0 < best) ? t0 : best;
+    }
+    mld_verify_pool_destroy(pool);
+
+    single = (t == 1) ? best : single;
+    printf("%7s threads = %3u: %10.0f sig/s, %5.2fx vs verify, "
+           "scaling %5.2f/%u\n",
+           "pool", t, (double)NJOBS / best, base / best, single / best, t);
+    if (t == maxthreads)
+    {
+      break;
+    }
+  }
+
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  long n;
+
+  n = argc > 1 ? atol(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+  if (n < 1)
+  {
+    n = 1;
+  }
+  printf("%d signatures under %d keys, best of %d runs\n", NJOBS, NKEYS,
+         NRUNS);
+  return bench((unsigned)n);
+}
+
+#else /* MLD_CONFIG_USE_PTHREADS */
+
+int main(void)
+{
+  printf("Verification pool not built; rebuild with PTHREADS=1\n");
+  return 0;
+}
+
+#endif /* !MLD_CONFIG_USE_PTHREADS */
@@ -1 +1,11 @@
 # SPDX-License-Identifier: Apache-2.0
+#
+# Automatically detect system architecture and set CFLAGS accordingly.
+# This only applies to native builds; cross builds must set CFLAGS manually.
+
+ifeq ($(CROSS_PREFIX),)
+ifeq ($(HOST_PLATFORM),Linux-x86_64)
+	CFLAGS += -mavx2 -mbmi -mbmi2
+	CFLAGS += -DMLD_FORCE_X86_64
+endif
+endif
@@ -2,8 +2,12 @@
 
 FIPS202_SRCS = $(wildcard mldsa/fips202/*.c)
 SOURCES += $(wildcard mldsa/*.c)
+ifeq ($(OPT),1)
+	SOURCES += $(wildcard mldsa/native/x86_64/src/*.[csS])
+	FIPS202_SRCS += $(wildcard mldsa/fips202/native/x86_64/src/*.[csS])
+endif
 
-ALL_TESTS = test_mldsa acvp_mldsa bench_mldsa bench_components_mldsa gen_NISTKAT gen_KAT
+ALL_TESTS = test_mldsa acvp_mldsa bench_mldsa bench_components_mldsa bench_verify_pool_mldsa bench_sign_pool_mldsa bench_sign_stats_mldsa gen_NISTKAT gen_KAT
 NON_NIST_TESTS = $(filter-out gen_NISTKAT,$(ALL_TESTS))
 
 MLDSA44_DIR = $(BUILD_DIR)/mldsa44
@@ -78,12 +78,33 @@ endif
 AUTO ?= 1
 CYCLES ?=
 OPT ?= 1
-RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO
+PTHREADS ?= 0
+SIGN_STATS ?= 0
+REDUCE_RAM ?= 0
+RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO PTHREADS SIGN_STATS REDUCE_RAM
 
 ifeq ($(AUTO),1)
 include test/mk/auto.mk
 endif
 
+ifeq ($(OPT),1)
+	CFLAGS += -DMLD_CONFIG_USE_NATIVE_BACKEND_ARITH
+	CFLAGS += -DMLD_CONFIG_USE_NATIVE_BACKEND_FIPS202
+endif
+
+ifeq ($(PTHREADS),1)
+	CFLAGS += -DMLD_CONFIG_USE_PTHREADS -pthread
+	LDLIBS += -lpthread
+endif
+
+ifeq ($(SIGN_STATS),1)
+	CFLAGS += -DMLD_CONFIG_SIGN_STATS
+endif
+
+ifeq ($(REDUCE_RAM),1)
+	CFLAGS += -DMLD_CONFIG_REDUCE_RAM
+endif
+
 BUILD_DIR ?= test/build
 
 MAKE_OBJS = $(2:%=$(1)/%.o)
@@ -33,6 +33,24 @@ void randombytes_reset(void)
   outleft = 0;
 }
 
+static void surf(void);
+
+void randombytes_seek(uint64_t pos)
+{
+  /* Every block of output yields 8 bytes, and block i is computed from
+   * the counter value i + 1 */
+  uint64_t blocks = pos / 8 + (pos % 8 != 0);
+
+  randombytes_reset();
+  in[0] = (uint32_t)blocks;
+  in[1] = (uint32_t)(blocks >> 32);
+  if (pos % 8 != 0)
+  {
+    surf();
+    outleft = 8 - (int32_t)(pos % 8);
+  }
+}
+
 #define ROTATE(x, b) (((x) << (b)) | ((x) >> (32 - (b))))
 #define MUSH(i, b) x = t[i] += (((x ^ seed[i]) + sum) ^ ROTATE(x, b));
 
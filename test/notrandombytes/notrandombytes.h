@@ -20,4 +20,8 @@
 void randombytes_reset(void);
 void randombytes(uint8_t *buf, size_t n);
 
+/* Restarts the stream at byte position pos, as if randombytes_reset() had
+ * been called and pos bytes had been drawn since. */
+void randombytes_seek(uint64_t pos);
+
 #endif /* NOTRANDOMBYTES_H */
@@ -4,14 +4,32 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
-#include "../mldsa/api.h"
+#include "../mldsa/sign.h"
+#include "../mldsa/sign_pool.h"
+#include "../mldsa/verify_pool.h"
 #include "notrandombytes/notrandombytes.h"
 
 #define NTESTS 100
 #define MLEN 59
 #define CTXLEN 1
+/* Message length for the incremental API, spanning several SHAKE256
+ * blocks */
+#define MLEN_LONG (3 * SHAKE256_RATE + 17)
+
+/* notrandombytes is a deterministic stream. Restarting it at the same
+ * position with randombytes_seek() lets two signing functions draw the
+ * same randomness, so that their signatures can be compared. */
+static uint64_t random_pos(void)
+{
+  uint8_t b[4];
+  randombytes(b, 4);
+  return (uint64_t)b[0] | ((uint64_t)b[1] << 8) | ((uint64_t)b[2] << 16) |
+         ((uint64_t)b[3] << 24);
+}
 
 static int test_sign(void)
 {
@@ -198,26 +216,623 @@ static int test_wrong_ctx(void)
   return 0;
 }
 
+static int test_sign_expanded(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t sig2[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  mld_expanded_sk esk;
+  mld_expanded_pk epk;
+  size_t siglen, siglen2;
+  size_t idx;
+  uint64_t pos;
+  int rc, rc2;
+
+  crypto_sign_keypair(pk, sk);
+  crypto_sign_expand_sk(&esk, sk);
+  crypto_sign_expand_pk(&epk, pk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  pos = random_pos();
+
+  randombytes_seek(pos);
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  randombytes_seek(pos);
+  crypto_sign_signature_expanded(sig2, &siglen2, m, MLEN, ctx, CTXLEN, &esk);
+
+  if (siglen != siglen2 || memcmp(sig, sig2, CRYPTO_BYTES))
+  {
+    printf("ERROR: crypto_sign_signature_expanded - wrong signature\n");
+    return 1;
+  }
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  rc2 = crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, &epk);
+  if (rc || rc2)
+  {
+    printf("ERROR: crypto_sign_verify_expanded\n");
+    return 1;
+  }
+
+  /* flip bit in signature */
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= CRYPTO_BYTES;
+  sig[idx] ^= 1;
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  rc2 = crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, &epk);
+  if (!rc || rc != rc2)
+  {
+    printf("ERROR: wrong_sig: crypto_sign_verify_expanded\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Chunkings of the message for the incremental API. Each row lists the
+ * chunk lengths, with the remainder of the message in a final chunk. They
+ * include empty chunks and chunks straddling SHAKE256_RATE (136). */
+#define NCHUNKINGS 6
+#define MAXCHUNKS 4
+static const size_t chunkings[NCHUNKINGS][MAXCHUNKS] = {
+    {0, 0, 0, 0},
+    {MLEN_LONG, 0, 0, 0},
+    {1, 135, 0, 1},
+    {100, 72, 200, 0},
+    {SHAKE256_RATE, SHAKE256_RATE, SHAKE256_RATE, 0},
+    {135, 2, 134, 0},
+};
+
+static int test_sign_incremental(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t sig2[CRYPTO_BYTES];
+  uint8_t m[MLEN_LONG];
+  uint8_t ctx[CTXLEN];
+  mld_message_state st;
+  size_t siglen, siglen2;
+  size_t off;
+  size_t idx;
+  unsigned i, j;
+  uint64_t pos;
+  int rc, rc2;
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN_LONG);
+  pos = random_pos();
+
+  randombytes_seek(pos);
+  crypto_sign_signature(sig, &siglen, m, MLEN_LONG, ctx, CTXLEN, sk);
+  rc = crypto_sign_verify(sig, siglen, m, MLEN_LONG, ctx, CTXLEN, pk);
+  if (rc)
+  {
+    printf("ERROR: crypto_sign_verify\n");
+    return 1;
+  }
+
+  for (i = 0; i < NCHUNKINGS; i++)
+  {
+    randombytes_seek(pos);
+    crypto_sign_signature_init(&st, ctx, CTXLEN, sk);
+    off = 0;
+    for (j = 0; j < MAXCHUNKS; j++)
+    {
+      crypto_sign_signature_update(&st, m + off, chunkings[i][j]);
+      off += chunkings[i][j];
+    }
+    crypto_sign_signature_update(&st, m + off, MLEN_LONG - off);
+    crypto_sign_signature_final(&st, sig2, &siglen2, sk);
+
+    if (siglen != siglen2 || memcmp(sig, sig2, CRYPTO_BYTES))
+    {
+      printf("ERROR: crypto_sign_signature_final - wrong signature\n");
+      return 1;
+    }
+
+    crypto_sign_verify_init(&st, ctx, CTXLEN, pk);
+    off = 0;
+    for (j = 0; j < MAXCHUNKS; j++)
+    {
+      crypto_sign_verify_update(&st, m + off, chunkings[i][j]);
+      off += chunkings[i][j];
+    }
+    crypto_sign_verify_update(&st, m + off, MLEN_LONG - off);
+    rc2 = crypto_sign_verify_final(&st, sig, siglen, pk);
+
+    if (rc2 != rc)
+    {
+      printf("ERROR: crypto_sign_verify_final\n");
+      return 1;
+    }
+  }
+
+  /* flip bit in message; both must reject */
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= MLEN_LONG;
+  m[idx] ^= 1;
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN_LONG, ctx, CTXLEN, pk);
+  crypto_sign_verify_init(&st, ctx, CTXLEN, pk);
+  crypto_sign_verify_update(&st, m, idx);
+  crypto_sign_verify_update(&st, m + idx, MLEN_LONG - idx);
+  rc2 = crypto_sign_verify_final(&st, sig, siglen, pk);
+  if (!rc || rc != rc2)
+  {
+    printf("ERROR: wrong_msg: crypto_sign_verify_final\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Runs key generation, signing and verification through one workspace,
+ * which is scrambled between the calls, and compares the results with
+ * the stack-based API */
+static int test_workspace(void *ws)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES], pk2[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES], sk2[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES], sig2[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  size_t siglen, siglen2;
+  size_t idx;
+  uint64_t pos;
+  int rc, rc2;
+
+  pos = random_pos();
+  randombytes_seek(pos);
+  crypto_sign_keypair(pk, sk);
+  memset(ws, 0xA5, crypto_sign_workspace_size());
+  randombytes_seek(pos);
+  crypto_sign_keypair_ws(pk2, sk2, ws);
+
+  if (memcmp(pk, pk2, CRYPTO_PUBLICKEYBYTES) ||
+      memcmp(sk, sk2, CRYPTO_SECRETKEYBYTES))
+  {
+    printf("ERROR: crypto_sign_keypair_ws - wrong key pair\n");
+    return 1;
+  }
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  pos = random_pos();
+
+  randombytes_seek(pos);
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  memset(ws, 0x5A, crypto_sign_workspace_size());
+  randombytes_seek(pos);
+  crypto_sign_signature_ws(sig2, &siglen2, m, MLEN, ctx, CTXLEN, sk, ws);
+
+  if (siglen != siglen2 || memcmp(sig, sig2, CRYPTO_BYTES))
+  {
+    printf("ERROR: crypto_sign_signature_ws - wrong signature\n");
+    return 1;
+  }
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  memset(ws, 0xFF, crypto_sign_workspace_size());
+  rc2 = crypto_sign_verify_ws(sig, siglen, m, MLEN, ctx, CTXLEN, pk, ws);
+  if (rc || rc2)
+  {
+    printf("ERROR: crypto_sign_verify_ws\n");
+    return 1;
+  }
+
+  /* flip bit in signature */
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= CRYPTO_BYTES;
+  sig[idx] ^= 1;
+
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  rc2 = crypto_sign_verify_ws(sig, siglen, m, MLEN, ctx, CTXLEN, pk, ws);
+  if (!rc || rc != rc2)
+  {
+    printf("ERROR: wrong_sig: crypto_sign_verify_ws\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Batch verification of a mix of valid and invalid signatures, spanning
+ * two groups of four. The result for every signature must be the one of
+ * crypto_sign_verify(). */
+#define NBATCH 7
+
+static int test_verify_batch(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sigs[NBATCH][CRYPTO_BYTES];
+  uint8_t msgs[NBATCH][MLEN];
+  uint8_t ctx[CTXLEN];
+  const uint8_t *sig[NBATCH], *m[NBATCH], *ctxs[NBATCH];
+  size_t siglen[NBATCH], mlen[NBATCH], ctxlen[NBATCH];
+  int ret[NBATCH];
+  int rc, res;
+  unsigned k;
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+
+  for (k = 0; k < NBATCH; k++)
+  {
+    mlen[k] = MLEN - k;
+    randombytes(msgs[k], mlen[k]);
+    crypto_sign_signature(sigs[k], &siglen[k], msgs[k], mlen[k], ctx, CTXLEN,
+                          sk);
+    sig[k] = sigs[k];
+    m[k] = msgs[k];
+    ctxs[k] = ctx;
+    ctxlen[k] = CTXLEN;
+  }
+
+  /* truncated signature */
+  siglen[1] = CRYPTO_BYTES - 1;
+
+  /* first coefficient of z set to -(gamma1 - 1), above the norm bound */
+  sigs[2][MLDSA_CTILDEBYTES + 0] = 0xFF;
+  sigs[2][MLDSA_CTILDEBYTES + 1] = 0xFF;
+  sigs[2][MLDSA_CTILDEBYTES + 2] = 0xFF;
+
+  /* malformed hint: more than omega hints in total */
+  sigs[3][CRYPTO_BYTES - 1] = MLDSA_OMEGA + 1;
+
+  /* wrong message */
+  msgs[5][0] ^= 1;
+
+  rc = crypto_sign_verify_batch(ret, sig, siglen, m, mlen, ctxs, ctxlen,
+                                NBATCH, pk);
+
+  res = 0;
+  for (k = 0; k < NBATCH; k++)
+  {
+    if (ret[k] != crypto_sign_verify(sig[k], siglen[k], m[k], mlen[k], ctx,
+                                     CTXLEN, pk))
+    {
+      printf("ERROR: crypto_sign_verify_batch - wrong result %u\n", k);
+      return 1;
+    }
+    res |= ret[k];
+  }
+
+  if (rc != res || ret[0] || !ret[1] || !ret[2] || !ret[3] || ret[4] ||
+      !ret[5] || ret[6])
+  {
+    printf("ERROR: crypto_sign_verify_batch\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* Batch signing must give the same signatures as signing the messages
+ * one after the other with the same randomness. The batch sizes cover
+ * partial and full groups of four, and the lengths are either all equal,
+ * so that mu is computed four at a time, or mixed. */
+#define MAXBATCH 9
+static const size_t batch_sizes[] = {1, 3, 4, 5, 9};
+
+static int test_sign_batch(void *bws)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sigs[MAXBATCH][CRYPTO_BYTES];
+  uint8_t sigs2[MAXBATCH][CRYPTO_BYTES];
+  uint8_t msgs[MAXBATCH][MLEN];
+  uint8_t ctx[CTXLEN];
+  uint8_t *sig2[MAXBATCH];
+  const uint8_t *m[MAXBATCH], *ctxs[MAXBATCH];
+  size_t siglen[MAXBATCH], siglen2[MAXBATCH], mlen[MAXBATCH];
+  size_t ctxlen[MAXBATCH];
+  mld_expanded_sk esk;
+  size_t n;
+  unsigned i, k, mixed;
+  uint64_t pos;
+
+  crypto_sign_keypair(pk, sk);
+  crypto_sign_expand_sk(&esk, sk);
+  randombytes(ctx, CTXLEN);
+
+  for (k = 0; k < MAXBATCH; k++)
+  {
+    randombytes(msgs[k], MLEN);
+    sig2[k] = sigs2[k];
+    m[k] = msgs[k];
+    ctxs[k] = ctx;
+    ctxlen[k] = CTXLEN;
+  }
+
+  for (i = 0; i < sizeof(batch_sizes) / sizeof(batch_sizes[0]); i++)
+  {
+    n = batch_sizes[i];
+    for (mixed = 0; mixed < 2; mixed++)
+    {
+      for (k = 0; k < n; k++)
+      {
+        mlen[k] = mixed ? MLEN - 3 * k : MLEN;
+      }
+
+      pos = random_pos();
+      randombytes_seek(pos);
+      for (k = 0; k < n; k++)
+      {
+        crypto_sign_signature(sigs[k], &siglen[k], m[k], mlen[k], ctx, CTXLEN,
+                              sk);
+      }
+
+      randombytes_seek(pos);
+      crypto_sign_signature_batch(sig2, siglen2, m, mlen, ctxs, ctxlen, n, sk);
+      for (k = 0; k < n; k++)
+      {
+        if (siglen2[k] != siglen[k] || memcmp(sigs2[k], sigs[k], CRYPTO_BYTES))
+        {
+          printf("ERROR: crypto_sign_signature_batch - wrong signature\n");
+          return 1;
+        }
+      }
+
+      memset(bws, 0xA5, crypto_sign_batch_workspace_size());
+      memset(sigs2, 0, sizeof(sigs2));
+      randombytes_seek(pos);
+      crypto_sign_signature_batch_expanded_ws(sig2, siglen2, m, mlen, ctxs,
+                                              ctxlen, n, &esk, bws);
+      for (k = 0; k < n; k++)
+      {
+        if (siglen2[k] != siglen[k] || memcmp(sigs2[k], sigs[k], CRYPTO_BYTES))
+        {
+          printf(
+              "ERROR: crypto_sign_signature_batch_expanded_ws - wrong "
+              "signature\n");
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+#if defined(MLD_CONFIG_USE_PTHREADS)
+/* Verification pool on jobs under several keys in random order, where the
+ * public key of one key is also passed through a second copy. Every
+ * result must be the one of crypto_sign_verify(). */
+#define POOL_THREADS 3
+#define POOL_NKEYS 3
+#define POOL_NJOBS 24
+
+static int check_verify_pool(mld_verify_pool *pool,
+                             const mld_verify_job *jobs, int *ret)
+{
+  unsigned i;
+  int rc, res;
+
+  rc = mld_verify_pool_run(pool, ret, jobs, POOL_NJOBS);
+  res = 0;
+  for (i = 0; i < POOL_NJOBS; i++)
+  {
+    if (ret[i] != crypto_sign_verify(jobs[i].sig, jobs[i].siglen, jobs[i].m,
+                                     jobs[i].mlen, jobs[i].ctx,
+                                     jobs[i].ctxlen, jobs[i].pk))
+    {
+      printf("ERROR: mld_verify_pool_run - wrong result %u\n", i);
+      return -2;
+    }
+    res |= ret[i];
+  }
+  if (rc != res)
+  {
+    printf("ERROR: mld_verify_pool_run - wrong return value\n");
+    return -2;
+  }
+  return rc;
+}
+
+static int test_verify_pool(void)
+{
+  static uint8_t pk[POOL_NKEYS + 1][CRYPTO_PUBLICKEYBYTES];
+  static uint8_t sk[POOL_NKEYS][CRYPTO_SECRETKEYBYTES];
+  static uint8_t sigs[POOL_NJOBS][CRYPTO_BYTES];
+  uint8_t msgs[POOL_NJOBS][MLEN];
+  uint8_t ctx[256] = {0};
+  mld_verify_job jobs[POOL_NJOBS];
+  int ret[POOL_NJOBS];
+  mld_verify_pool *pool;
+  uint8_t key;
+  size_t idx;
+  unsigned i;
+  int rc;
+
+  for (i = 0; i < POOL_NKEYS; i++)
+  {
+    crypto_sign_keypair(pk[i], sk[i]);
+  }
+  memcpy(pk[POOL_NKEYS], pk[0], CRYPTO_PUBLICKEYBYTES);
+  randombytes(ctx, CTXLEN);
+
+  for (i = 0; i < POOL_NJOBS; i++)
+  {
+    randombytes(&key, 1);
+    key %= POOL_NKEYS + 1;
+    randombytes(msgs[i], MLEN);
+    jobs[i].pk = pk[key];
+    jobs[i].sig = sigs[i];
+    jobs[i].m = msgs[i];
+    jobs[i].mlen = MLEN;
+    jobs[i].ctx = ctx;
+    jobs[i].ctxlen = CTXLEN;
+    crypto_sign_signature(sigs[i], &jobs[i].siglen, msgs[i], MLEN, ctx,
+                          CTXLEN, sk[key % POOL_NKEYS]);
+  }
+
+  pool = mld_verify_pool_create(POOL_THREADS);
+  if (pool == NULL)
+  {
+    printf("ERROR: mld_verify_pool_create\n");
+    return 1;
+  }
+
+  /* All valid */
+  rc = check_verify_pool(pool, jobs, ret);
+  if (rc != 0)
+  {
+    printf("ERROR: mld_verify_pool_run - valid signatures\n");
+    mld_verify_pool_destroy(pool);
+    return 1;
+  }
+
+  /* A corrupted signature is reported in its own slot only */
+  randombytes((uint8_t *)&idx, sizeof(size_t));
+  idx %= POOL_NJOBS;
+  sigs[idx][0] ^= 1;
+  rc = check_verify_pool(pool, jobs, ret);
+  sigs[idx][0] ^= 1;
+  if (rc != -1)
+  {
+    printf("ERROR: mld_verify_pool_run - corrupted signature\n");
+    mld_verify_pool_destroy(pool);
+    return 1;
+  }
+
+  /* Malformed jobs: truncated signature, overlong context, wrong key,
+   * malformed hint, wrong message, and z out of bounds */
+  jobs[1].siglen = CRYPTO_BYTES - 1;
+  jobs[3].ctxlen = 256;
+  jobs[5].pk = pk[(jobs[5].pk == pk[1]) ? 2 : 1];
+  sigs[7][CRYPTO_BYTES - 1] = MLDSA_OMEGA + 1;
+  msgs[11][0] ^= 1;
+  sigs[13][MLDSA_CTILDEBYTES + 0] = 0xFF;
+  sigs[13][MLDSA_CTILDEBYTES + 1] = 0xFF;
+  sigs[13][MLDSA_CTILDEBYTES + 2] = 0xFF;
+  rc = check_verify_pool(pool, jobs, ret);
+  mld_verify_pool_destroy(pool);
+  if (rc != -1 || !ret[1] || !ret[3] || !ret[5] || !ret[7] || !ret[11] ||
+      !ret[13])
+  {
+    printf("ERROR: mld_verify_pool_run - malformed jobs\n");
+    return 1;
+  }
+  return 0;
+}
+
+/* The signing pool must give the same signatures as the sequential
+ * rejection loop with the same randomness, with expanded and packed
+ * keys */
+#define POOL_NSIGS 4
+
+static int test_sign_pool(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES], sig2[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  mld_expanded_sk esk;
+  mld_sign_pool *pool;
+  size_t siglen, siglen2;
+  uint64_t pos;
+  unsigned i;
+  int r = 0;
+
+  crypto_sign_keypair(pk, sk);
+  crypto_sign_expand_sk(&esk, sk);
+  randombytes(ctx, CTXLEN);
+
+  pool = mld_sign_pool_create(POOL_THREADS);
+  if (pool == NULL)
+  {
+    printf("ERROR: mld_sign_pool_create\n");
+    return 1;
+  }
+
+  for (i = 0; i < POOL_NSIGS && r == 0; i++)
+  {
+    randombytes(m, MLEN);
+    pos = random_pos();
+
+    randombytes_seek(pos);
+    crypto_sign_signature_expanded(sig, &siglen, m, MLEN, ctx, CTXLEN, &esk);
+
+    randombytes_seek(pos);
+    r |= mld_sign_pool_signature_expanded(pool, sig2, &siglen2, m, MLEN, ctx,
+                                          CTXLEN, &esk);
+    if (r || siglen2 != siglen || memcmp(sig, sig2, CRYPTO_BYTES))
+    {
+      printf("ERROR: mld_sign_pool_signature_expanded - wrong signature\n");
+      r = 1;
+      break;
+    }
+
+    memset(sig2, 0, CRYPTO_BYTES);
+    randombytes_seek(pos);
+    r |= mld_sign_pool_signature(pool, sig2, &siglen2, m, MLEN, ctx, CTXLEN,
+                                 sk);
+    if (r || siglen2 != siglen || memcmp(sig, sig2, CRYPTO_BYTES))
+    {
+      printf("ERROR: mld_sign_pool_signature - wrong signature\n");
+      r = 1;
+    }
+  }
+
+  mld_sign_pool_destroy(pool);
+  return r;
+}
+#endif /* MLD_CONFIG_USE_PTHREADS */
+
 int main(void)
 {
   unsigned i;
   int r;
+  uint8_t *wsbuf, *bwsbuf;
+  void *ws, *bws;
 
   /* WARNING: Test-only
    * Normally, you would want to seed a PRNG with trustworthy entropy here. */
   randombytes_reset();
 
+  /* One workspace of each kind for all iterations, aligned to
+   * MLD_DEFAULT_ALIGN */
+  wsbuf = malloc(crypto_sign_workspace_size() + MLD_DEFAULT_ALIGN);
+  bwsbuf = malloc(crypto_sign_batch_workspace_size() + MLD_DEFAULT_ALIGN);
+  if (wsbuf == NULL || bwsbuf == NULL)
+  {
+    printf("ERROR: malloc\n");
+    free(wsbuf);
+    free(bwsbuf);
+    return 1;
+  }
+  ws = wsbuf + (MLD_DEFAULT_ALIGN -
+                (uintptr_t)wsbuf % MLD_DEFAULT_ALIGN) % MLD_DEFAULT_ALIGN;
+  bws = bwsbuf + (MLD_DEFAULT_ALIGN -
+                  (uintptr_t)bwsbuf % MLD_DEFAULT_ALIGN) % MLD_DEFAULT_ALIGN;
+
   for (i = 0; i < NTESTS; i++)
   {
     r = test_sign();
     r |= test_wrong_pk();
     r |= test_wrong_sig();
     r |= test_wrong_ctx();
+    r |= test_sign_expanded();
+    r |= test_sign_incremental();
+    r |= test_workspace(ws);
+    r |= test_verify_batch();
+    r |= test_sign_batch(bws);
+#if defined(MLD_CONFIG_USE_PTHREADS)
+    r |= test_verify_pool();
+    r |= test_sign_pool();
+#endif
     if (r)
     {
+      free(wsbuf);
+      free(bwsbuf);
       return 1;
     }
   }
+  free(wsbuf);
+  free(bwsbuf);
 
   printf("CRYPTO_SECRETKEYBYTES:  %d\n", CRYPTO_SECRETKEYBYTES);
   printf("CRYPTO_PUBLICKEYBYTES:  %d\n", CRYPTO_PUBLICKEYBYTES);